@@ -0,0 +1,66 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/adaptive_mutex.hpp>
+#include <stx/sync/spinlock.hpp>
+#include <mutex>
+#include <string>
+#include "bench.hpp"
+
+// Threads contending for one lock around short, medium and long critical
+// sections: the time per acquisition, and the spin budget adaptive_mutex
+// settles on.
+
+template<class Lock>
+std::uint32_t budget_of(Lock const&)
+{
+    return 0;
+}
+
+std::uint32_t budget_of(stx::adaptive_mutex const& m)
+{
+    return m.spin_budget();
+}
+
+template<class Lock>
+void run(char const* name, unsigned threads, std::size_t per_thread, unsigned work)
+{
+    Lock lock;
+    unsigned long counter = 0;
+    double ns = stx_bench::run_threads(threads, [&](unsigned)
+    {
+        for (std::size_t i = 0; i != per_thread; ++i)
+        {
+            std::lock_guard<Lock> guard(lock);
+            for (unsigned k = 0; k != work; ++k)
+            {
+                ++counter;
+                stx_bench::keep(counter);
+            }
+        }
+    });
+    std::size_t total = threads * per_thread;
+    std::printf("%-40s %12zu %10.2f ns/op  budget %4u\n",
+        (std::string(name) + " x" + std::to_string(threads) + " work=" + std::to_string(work)).c_str(),
+        total, ns / double(total), unsigned(budget_of(lock)));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t ops = stx_bench::arg(argc, argv, 1, 2000000);
+    unsigned max = unsigned(stx_bench::arg(argc, argv, 2, 0));
+    for (unsigned work : {1u, 100u, 10000u})
+    {
+        // Keep the total work about the same for each length.
+        std::size_t per_thread = ops / work + 1;
+        for (unsigned n : stx_bench::thread_counts(max))
+        {
+            run<stx::adaptive_mutex>("adaptive_mutex", n, per_thread, work);
+            run<stx::spinlock>("spinlock", n, per_thread, work);
+            run<std::mutex>("std::mutex", n, per_thread, work);
+        }
+    }
+}
\ No newline at end of file
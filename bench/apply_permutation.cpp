@@ -0,0 +1,64 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/algorithm/apply_permutation.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+// A random permutation applied in place by following the cycles, on 1 to
+// N threads, and out of place into another array, per element.
+
+struct wide
+{
+    std::uint64_t w[8];
+};
+
+template<class T>
+void run(char const* type, std::size_t n, unsigned max)
+{
+    std::mt19937_64 rng(n);
+    std::vector<std::uint32_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0u);
+    std::shuffle(perm.begin(), perm.end(), rng);
+    std::vector<T> v(n), out(n);
+    std::vector<std::uint32_t> idx;
+    auto setup = [&] { idx = perm; };
+    std::string suffix = std::string(" ") + type;
+
+    for (unsigned threads : stx_bench::thread_counts(max))
+    {
+        double ns = stx_bench::time_per_op(n, setup, [&]
+        {
+            if (threads == 1)
+                stx::apply_permutation(v.begin(), v.end(), idx.begin());
+            else
+                stx::apply_permutation(v.begin(), v.end(), idx.begin(), threads);
+            stx_bench::keep(v.front());
+        });
+        stx_bench::report(("apply_permutation x" + std::to_string(threads) + suffix).c_str(), n, ns);
+    }
+    double ns = stx_bench::time_per_op(n, [&]
+    {
+        stx::apply_permutation_to(v.begin(), v.end(), perm.begin(), out.begin());
+        stx_bench::keep(out.front());
+    });
+    stx_bench::report(("apply_permutation_to" + suffix).c_str(), n, ns);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max = stx_bench::arg(argc, argv, 1, std::size_t(1) << 24);
+    unsigned threads = unsigned(stx_bench::arg(argc, argv, 2, 0));
+    for (std::size_t n = 1 << 12; n <= max; n *= 16)
+    {
+        run<std::int64_t>("int64", n, threads);
+        run<wide>("64B", n, threads);
+    }
+}
@@ -0,0 +1,59 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/algorithm/apply_permutation.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+// A random permutation applied in place by following the cycles, by the
+// cache-blocked bucketing and by the adaptive choice between the two,
+// from cache-resident to memory-bound sizes, per element.
+
+struct pair16
+{
+    std::uint64_t key, value;
+};
+
+template<class T, class... Tag>
+void measure(std::string const& name, std::vector<T>& v, std::vector<std::uint32_t> const& perm, Tag... tag)
+{
+    std::vector<std::uint32_t> idx;
+    double ns = stx_bench::time_per_op(v.size(), [&] { idx = perm; }, [&]
+    {
+        stx::apply_permutation(tag..., v.begin(), v.end(), idx.begin());
+        stx_bench::keep(v.front());
+    });
+    stx_bench::report(name.c_str(), v.size(), ns);
+}
+
+template<class T>
+void run(char const* type, std::size_t n)
+{
+    std::mt19937_64 rng(n);
+    std::vector<std::uint32_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0u);
+    std::shuffle(perm.begin(), perm.end(), rng);
+    std::vector<T> v(n);
+    std::string suffix = std::string(" ") + type;
+    measure("cycles" + suffix, v, perm);
+    measure("cache_blocked" + suffix, v, perm, stx::cache_blocked);
+    measure("cache_adaptive" + suffix, v, perm, stx::cache_adaptive);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max = stx_bench::arg(argc, argv, 1, std::size_t(1) << 24);
+    for (std::size_t n = 1 << 12; n <= max; n *= 4)
+    {
+        run<std::uint32_t>("int32", n);
+        run<std::int64_t>("int64", n);
+        run<pair16>("16B", n);
+    }
+}
@@ -0,0 +1,125 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_BENCH_BENCH_HPP_INCLUDED
+#define STX_BENCH_BENCH_HPP_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstddef>
+#include <algorithm>
+
+namespace stx_bench
+{
+    using clock = std::chrono::steady_clock;
+
+    /// Keep the computation of `value` from being optimized away.
+    template<class T>
+    inline void keep(T const& value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        static void const* volatile sink;
+        sink = &value;
+#endif
+    }
+
+    inline double elapsed_ns(clock::time_point start)
+    {
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    }
+
+    /// The best of `runs` timings of `f()`, in nanoseconds per each of its
+    /// `ops` operations. `setup()` is called untimed before each run.
+    template<class Setup, class F>
+    double time_per_op(std::size_t ops, Setup setup, F f, int runs = 3)
+    {
+        double best = 0;
+        for (int i = 0; i != runs; ++i)
+        {
+            setup();
+            clock::time_point start = clock::now();
+            f();
+            double ns = elapsed_ns(start);
+            if (!i || ns < best)
+                best = ns;
+        }
+        return best / double(ops ? ops : 1);
+    }
+
+    template<class F>
+    double time_per_op(std::size_t ops, F f, int runs = 3)
+    {
+        return time_per_op(ops, [] {}, f, runs);
+    }
+
+    /// Run `f(t)` for each `t` in [0, threads) on its own thread, all
+    /// released at once, and return the wall time in nanoseconds.
+    template<class F>
+    double run_threads(unsigned threads, F f)
+    {
+        std::atomic<unsigned> ready(0);
+        std::atomic<bool> go(false);
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t != threads; ++t)
+        {
+            pool.emplace_back([&, t]
+            {
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+                f(t);
+            });
+        }
+        while (ready.load() != threads)
+            std::this_thread::yield();
+        clock::time_point start = clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& th : pool)
+            th.join();
+        return elapsed_ns(start);
+    }
+
+    /// The `p`-th percentile of `samples`, which are reordered.
+    inline double percentile(std::vector<double>& samples, double p)
+    {
+        if (samples.empty())
+            return 0;
+        std::size_t k = std::size_t(p / 100 * double(samples.size() - 1));
+        std::nth_element(samples.begin(), samples.begin() + std::ptrdiff_t(k), samples.end());
+        return samples[k];
+    }
+
+    /// The `i`-th command-line argument as a number, or `def`.
+    inline std::size_t arg(int argc, char** argv, int i, std::size_t def)
+    {
+        return i < argc? std::size_t(std::strtoull(argv[i], nullptr, 10)) : def;
+    }
+
+    /// The thread counts 1, 2, 4, ... up to `max`, which is included.
+    inline std::vector<unsigned> thread_counts(unsigned max)
+    {
+        if (!max)
+            max = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned> counts;
+        for (unsigned n = 1; n < max; n *= 2)
+            counts.push_back(n);
+        counts.push_back(max);
+        return counts;
+    }
+
+    inline void report(char const* name, std::size_t n, double ns)
+    {
+        std::printf("%-40s %12zu %10.2f ns/op\n", name, n, ns);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/algorithm/binary_search.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+// Random lookups in sorted arrays from cache-resident to memory-bound
+// sizes: stx::binary_search on vector iterators against std::lower_bound.
+
+template<class T>
+void run(char const* type, std::size_t n, std::size_t lookups)
+{
+    std::mt19937_64 rng(n);
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i != n; ++i)
+        v[i] = T(i * 3);
+    std::vector<T> keys(lookups);
+    for (T& k : keys)
+        k = T(rng() % (n * 3));
+
+    std::string suffix = std::string(" ") + type;
+    double ns = stx_bench::time_per_op(lookups, [&]
+    {
+        std::size_t found = 0;
+        for (T k : keys)
+        {
+            auto it = std::lower_bound(v.begin(), v.end(), k);
+            found += it != v.end() && !(k < *it);
+        }
+        stx_bench::keep(found);
+    });
+    stx_bench::report(("std::lower_bound" + suffix).c_str(), n, ns);
+    ns = stx_bench::time_per_op(lookups, [&]
+    {
+        std::size_t found = 0;
+        for (T k : keys)
+            found += stx::binary_search(v.begin(), v.end(), k) != v.end();
+        stx_bench::keep(found);
+    });
+    stx_bench::report(("stx::binary_search" + suffix).c_str(), n, ns);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max = stx_bench::arg(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t lookups = stx_bench::arg(argc, argv, 2, 1000000);
+    for (std::size_t n = 1024; n <= max; n *= 8)
+    {
+        run<std::int32_t>("int32", n, lookups);
+        run<std::int64_t>("int64", n, lookups);
+        run<double>("double", n, lookups);
+    }
+}
\ No newline at end of file
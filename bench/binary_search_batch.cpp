@@ -0,0 +1,61 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/algorithm/binary_search.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+// Random lookups in sorted int64 arrays, one at a time with binary_search
+// and in lock-step groups of different sizes with binary_search_batch.
+
+using iter = std::vector<std::int64_t>::const_iterator;
+
+template<std::size_t Group>
+void run_batch(std::size_t n, std::vector<std::int64_t> const& v, std::vector<std::int64_t> const& keys, std::vector<iter>& out)
+{
+    double ns = stx_bench::time_per_op(keys.size(), [&]
+    {
+        stx::binary_search_batch<Group>(v.begin(), v.end(), keys.begin(), keys.end(), out.begin());
+        stx_bench::keep(out.back());
+    });
+    stx_bench::report(("binary_search_batch<" + std::to_string(Group) + ">").c_str(), n, ns);
+}
+
+void run(std::size_t n, std::size_t lookups)
+{
+    std::mt19937_64 rng(n);
+    std::vector<std::int64_t> v(n);
+    for (std::size_t i = 0; i != n; ++i)
+        v[i] = std::int64_t(i * 3);
+    std::vector<std::int64_t> keys(lookups);
+    for (std::int64_t& k : keys)
+        k = std::int64_t(rng() % (n * 3));
+    std::vector<iter> out(lookups);
+
+    double ns = stx_bench::time_per_op(lookups, [&]
+    {
+        for (std::size_t i = 0; i != lookups; ++i)
+            out[i] = stx::binary_search(v.cbegin(), v.cend(), keys[i]);
+        stx_bench::keep(out.back());
+    });
+    stx_bench::report("binary_search", n, ns);
+    run_batch<1>(n, v, keys, out);
+    run_batch<4>(n, v, keys, out);
+    run_batch<8>(n, v, keys, out);
+    run_batch<16>(n, v, keys, out);
+    run_batch<32>(n, v, keys, out);
+    run_batch<64>(n, v, keys, out);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max = stx_bench::arg(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t lookups = stx_bench::arg(argc, argv, 2, 1000000);
+    for (std::size_t n = 1024; n <= max; n *= 8)
+        run(n, lookups);
+}
@@ -0,0 +1,116 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/event.hpp>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <condition_variable>
+#include "bench.hpp"
+
+// Two threads ping-ponging through a pair of events: the round trip of
+// set() waking a blocked waiter, with `idle` other threads blocked in
+// wait_any on events of their own.
+
+// The textbook event, for reference.
+class condvar_event
+{
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _set = false;
+
+public:
+
+    void set()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _set = true;
+        }
+        _cond.notify_all();
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _set = false;
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _set; });
+    }
+};
+
+struct single
+{
+    template<class Event>
+    static void wait(Event& ev, Event&)
+    {
+        ev.wait();
+    }
+};
+
+struct any
+{
+    static void wait(stx::event& ev, stx::event& never)
+    {
+        stx::wait_any(ev, never);
+    }
+};
+
+template<class Event, class How>
+void run(char const* name, std::size_t rounds, unsigned idle)
+{
+    std::unique_ptr<stx::event[]> parked(new stx::event[2 * idle + 1]);
+    std::vector<std::thread> sleepers;
+    for (unsigned i = 0; i != idle; ++i)
+    {
+        sleepers.emplace_back([&parked, i]
+        {
+            stx::wait_any(parked[2 * i], parked[2 * i + 1]);
+        });
+    }
+
+    Event ping, pong, never;
+    std::thread other([&]
+    {
+        for (std::size_t i = 0; i != rounds; ++i)
+        {
+            How::wait(ping, never);
+            ping.reset();
+            pong.set();
+        }
+    });
+    stx_bench::clock::time_point start = stx_bench::clock::now();
+    for (std::size_t i = 0; i != rounds; ++i)
+    {
+        ping.set();
+        How::wait(pong, never);
+        pong.reset();
+    }
+    double ns = stx_bench::elapsed_ns(start);
+    other.join();
+
+    for (unsigned i = 0; i != idle; ++i)
+        parked[2 * i].set();
+    for (std::thread& t : sleepers)
+        t.join();
+    std::string label = std::string(name) + " idle=" + std::to_string(idle);
+    stx_bench::report(label.c_str(), rounds, ns / double(rounds));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t rounds = stx_bench::arg(argc, argv, 1, 20000);
+    for (unsigned idle : {0u, 16u, 64u})
+    {
+        run<stx::event, single>("event", rounds, idle);
+        run<stx::event, any>("event wait_any", rounds, idle);
+        run<condvar_event, single>("condvar event", rounds, idle);
+    }
+}
\ No newline at end of file
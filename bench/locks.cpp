@@ -0,0 +1,82 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/spinlock.hpp>
+#include <stx/sync/queue_lock.hpp>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include "bench.hpp"
+
+// Threads contending for one lock around a short critical section, from
+// 1 to N threads: throughput and the p99 latency of lock().
+
+// The plain test-and-set loop, for reference.
+class tas_lock
+{
+    std::atomic_flag _flag = ATOMIC_FLAG_INIT;
+
+public:
+
+    void lock() noexcept
+    {
+        while (_flag.test_and_set(std::memory_order_acquire));
+    }
+
+    void unlock() noexcept
+    {
+        _flag.clear(std::memory_order_release);
+    }
+};
+
+template<class Lock>
+void run(char const* name, unsigned threads, std::size_t per_thread)
+{
+    Lock lock;
+    std::size_t counter = 0;
+    std::vector<std::vector<double>> latencies(threads);
+    double ns = stx_bench::run_threads(threads, [&](unsigned t)
+    {
+        std::vector<double>& samples = latencies[t];
+        samples.reserve(per_thread / 16 + 1);
+        for (std::size_t i = 0; i != per_thread; ++i)
+        {
+            if (i % 16)
+                lock.lock();
+            else
+            {
+                stx_bench::clock::time_point start = stx_bench::clock::now();
+                lock.lock();
+                samples.push_back(stx_bench::elapsed_ns(start));
+            }
+            ++counter;
+            lock.unlock();
+        }
+    });
+    std::vector<double> all;
+    for (std::vector<double>& samples : latencies)
+        all.insert(all.end(), samples.begin(), samples.end());
+    std::size_t total = threads * per_thread;
+    std::printf("%-40s %12zu %10.2f ns/op  p99 %10.0f ns\n",
+        (std::string(name) + " x" + std::to_string(threads)).c_str(),
+        total, ns / double(total), stx_bench::percentile(all, 99));
+    stx_bench::keep(counter);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t per_thread = stx_bench::arg(argc, argv, 1, 1000000);
+    unsigned max = unsigned(stx_bench::arg(argc, argv, 2, 0));
+    for (unsigned n : stx_bench::thread_counts(max))
+    {
+        run<tas_lock>("test-and-set", n, per_thread);
+        run<stx::basic_spinlock<stx::pause_backoff>>("spinlock<pause_backoff>", n, per_thread);
+        run<stx::spinlock>("spinlock<exponential_backoff>", n, per_thread);
+        run<stx::ticket_lock>("ticket_lock", n, per_thread);
+        run<stx::clh_lock>("clh_lock", n, per_thread);
+        run<std::mutex>("std::mutex", n, per_thread);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/mpsc_queue.hpp>
+#include <stx/container/offset_list.hpp>
+#include <stx/sync/spinlock.hpp>
+#include <mutex>
+#include <string>
+#include "bench.hpp"
+
+// N producers and one consumer draining in batches: mpsc_queue vs.
+// offset_list guarded by stx::spinlock or std::mutex.
+template<class Mutex>
+struct locked_queue
+{
+    Mutex mutex;
+    stx::offset_list<int> list;
+
+    void push(int x)
+    {
+        std::lock_guard<Mutex> lock(mutex);
+        list.push_back(x);
+    }
+
+    template<class F>
+    std::size_t consume_all(F f)
+    {
+        stx::offset_list<int> batch;
+        {
+            std::lock_guard<Mutex> lock(mutex);
+            batch.swap(list);
+        }
+        std::size_t n = 0;
+        for (int& x : batch)
+        {
+            f(x);
+            ++n;
+        }
+        return n;
+    }
+};
+
+template<class Queue>
+void run(char const* name, unsigned producers, std::size_t per_producer)
+{
+    Queue q;
+    std::size_t total = producers * per_producer;
+    double ns = stx_bench::run_threads(producers + 1, [&](unsigned t)
+    {
+        if (t == producers)
+        {
+            long long sum = 0;
+            for (std::size_t n = 0; n != total;)
+            {
+                n += q.consume_all([&](int x)
+                {
+                    sum += x;
+                });
+            }
+            stx_bench::keep(sum);
+        }
+        else
+        {
+            for (std::size_t i = 0; i != per_producer; ++i)
+                q.push(int(i));
+        }
+    });
+    stx_bench::report((std::string(name) + " x" + std::to_string(producers)).c_str(), total, ns / double(total));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t per_producer = stx_bench::arg(argc, argv, 1, 200000);
+    unsigned max = unsigned(stx_bench::arg(argc, argv, 2, 0));
+    for (unsigned n : stx_bench::thread_counts(max))
+    {
+        run<stx::mpsc_queue<int>>("mpsc_queue", n, per_producer);
+        run<locked_queue<stx::spinlock>>("offset_list+spinlock", n, per_producer);
+        run<locked_queue<std::mutex>>("offset_list+std::mutex", n, per_producer);
+    }
+}
\ No newline at end of file
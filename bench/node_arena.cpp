@@ -0,0 +1,69 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/memory/node_arena.hpp>
+#include <stx/container/offset_list.hpp>
+#include <string>
+#include <random>
+#include "bench.hpp"
+
+// offset_list with std::allocator vs. arena_allocator: push_back, erase-heavy
+// churn, and traversal of the churned list.
+template<class List, class Make>
+void run(char const* name, std::size_t n, Make make)
+{
+    std::string prefix(name);
+    stx_bench::report((prefix + " push_back").c_str(), n, stx_bench::time_per_op(n, [&]
+    {
+        List l(make());
+        for (std::size_t i = 0; i != n; ++i)
+            l.push_back(int(i));
+        stx_bench::keep(l);
+    }));
+
+    List l(make());
+    for (std::size_t i = 0; i != n; ++i)
+        l.push_back(int(i));
+    std::mt19937 rng(42);
+    stx_bench::report((prefix + " churn").c_str(), n, stx_bench::time_per_op(n, [&]
+    {
+        // Erase every other element and push new ones at random ends.
+        bool odd = false;
+        l.remove_if([&](int)
+        {
+            return odd = !odd;
+        });
+        for (std::size_t i = 0; i != n / 2; ++i)
+        {
+            if (rng() & 1)
+                l.push_back(int(i));
+            else
+                l.push_front(int(i));
+        }
+    }));
+
+    stx_bench::report((prefix + " traverse").c_str(), n, stx_bench::time_per_op(n, [&]
+    {
+        long long sum = 0;
+        for (int x : l)
+            sum += x;
+        stx_bench::keep(sum);
+    }));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = stx_bench::arg(argc, argv, 1, 1000000);
+    run<stx::offset_list<int>>("std::allocator", n, []
+    {
+        return std::allocator<int>();
+    });
+    stx::node_arena arena;
+    run<stx::offset_list<int, stx::arena_allocator<int>>>("arena_allocator", n, [&]
+    {
+        return stx::arena_allocator<int>(arena);
+    });
+}
\ No newline at end of file
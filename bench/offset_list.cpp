@@ -0,0 +1,49 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/offset_list.hpp>
+#include <list>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+
+// offset_list::sort/merge vs. std::list on shuffled ints.
+template<class List>
+void run(char const* sort_name, char const* merge_name, std::vector<int> const& data)
+{
+    std::size_t n = data.size();
+    List l;
+    stx_bench::report(sort_name, n, stx_bench::time_per_op(n, [&]
+    {
+        l.assign(data.begin(), data.end());
+    }, [&]
+    {
+        l.sort();
+    }));
+
+    List a, b;
+    stx_bench::report(merge_name, n, stx_bench::time_per_op(n, [&]
+    {
+        a.assign(data.begin(), data.begin() + n / 2);
+        b.assign(data.begin() + n / 2, data.end());
+        a.sort();
+        b.sort();
+    }, [&]
+    {
+        a.merge(b);
+    }));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = stx_bench::arg(argc, argv, 1, 1000000);
+    std::vector<int> data(n);
+    std::mt19937 rng(42);
+    for (int& x : data)
+        x = int(rng());
+    run<stx::offset_list<int>>("offset_list::sort", "offset_list::merge", data);
+    run<std::list<int>>("std::list::sort", "std::list::merge", data);
+}
\ No newline at end of file
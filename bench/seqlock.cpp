@@ -0,0 +1,92 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/seqlock.hpp>
+#include <stx/sync/spinlock.hpp>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <shared_mutex>
+#include "bench.hpp"
+
+// N readers taking snapshots of a small struct that one writer updates
+// every 50us: the reads per second with a seqlock and with reader-writer
+// locks around the struct.
+
+struct quote
+{
+    long bid, ask, size;
+};
+
+// The seqlock<quote> interface over a reader-writer lock.
+template<class Lock>
+class locked
+{
+    mutable Lock _lock;
+    quote _value{};
+
+public:
+
+    quote load() const
+    {
+        std::shared_lock<Lock> guard(_lock);
+        return _value;
+    }
+
+    void store(quote const& value)
+    {
+        std::lock_guard<Lock> guard(_lock);
+        _value = value;
+    }
+};
+
+template<class Cell>
+void run(char const* name, unsigned readers, std::size_t writes)
+{
+    Cell cell;
+    std::atomic<bool> stop(false);
+    std::atomic<std::size_t> reads(0);
+    double ns = stx_bench::run_threads(readers + 1, [&](unsigned t)
+    {
+        if (t == readers)
+        {
+            for (std::size_t i = 0; i != writes; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                long n = long(i);
+                cell.store(quote{n, n + 1, n * 100});
+            }
+            stop = true;
+        }
+        else
+        {
+            std::size_t n = 0;
+            long sum = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                quote q = cell.load();
+                sum += q.ask - q.bid;
+                ++n;
+            }
+            stx_bench::keep(sum);
+            reads += n;
+        }
+    });
+    std::printf("%-40s %10.2f Mreads/s\n",
+        (std::string(name) + " x" + std::to_string(readers)).c_str(), double(reads) * 1e3 / ns);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t writes = stx_bench::arg(argc, argv, 1, 2000);
+    unsigned max = unsigned(stx_bench::arg(argc, argv, 2, 0));
+    for (unsigned n : stx_bench::thread_counts(max))
+    {
+        run<stx::seqlock<quote>>("seqlock", n, writes);
+        run<locked<stx::shared_spinlock>>("shared_spinlock", n, writes);
+        run<locked<std::shared_mutex>>("std::shared_mutex", n, writes);
+    }
+}
\ No newline at end of file
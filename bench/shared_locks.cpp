@@ -0,0 +1,71 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/spinlock.hpp>
+#include <stx/sync/sharded_shared_spinlock.hpp>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <shared_mutex>
+#include "bench.hpp"
+
+// Read-mostly locking: N readers saturating the lock and one writer.
+// Reports the reads per second and the writer's wait-time percentiles.
+template<class Lock>
+void run(char const* name, unsigned readers, std::size_t writes)
+{
+    Lock lock;
+    long data[8] = {};
+    std::atomic<bool> stop(false);
+    std::atomic<std::size_t> reads(0);
+    std::vector<double> waits;
+    double ns = stx_bench::run_threads(readers + 1, [&](unsigned t)
+    {
+        if (t == readers)
+        {
+            for (std::size_t i = 0; i != writes; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                stx_bench::clock::time_point start = stx_bench::clock::now();
+                std::lock_guard<Lock> guard(lock);
+                waits.push_back(stx_bench::elapsed_ns(start));
+                for (long& x : data)
+                    ++x;
+            }
+            stop = true;
+        }
+        else
+        {
+            std::size_t n = 0;
+            long sum = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                std::shared_lock<Lock> guard(lock);
+                for (long x : data)
+                    sum += x;
+                ++n;
+            }
+            stx_bench::keep(sum);
+            reads += n;
+        }
+    });
+    std::printf("%-40s %10.2f Mreads/s  writer wait p50 %8.0f p99 %8.0f max %8.0f ns\n",
+        (std::string(name) + " x" + std::to_string(readers)).c_str(),
+        double(reads) * 1e3 / ns,
+        stx_bench::percentile(waits, 50), stx_bench::percentile(waits, 99), stx_bench::percentile(waits, 100));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t writes = stx_bench::arg(argc, argv, 1, 2000);
+    unsigned max = unsigned(stx_bench::arg(argc, argv, 2, 0));
+    for (unsigned n : stx_bench::thread_counts(max))
+    {
+        run<stx::shared_spinlock>("shared_spinlock", n, writes);
+        run<stx::sharded_shared_spinlock>("sharded_shared_spinlock", n, writes);
+        run<std::shared_mutex>("std::shared_mutex", n, writes);
+    }
+}
\ No newline at end of file
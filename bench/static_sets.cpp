@@ -0,0 +1,69 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/eytzinger_set.hpp>
+#include <stx/container/static_btree_set.hpp>
+#include <stx/algorithm/binary_search.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+// Random membership tests against the same keys laid out as a sorted
+// array, an Eytzinger tree and a static B-tree, from cache-resident to
+// memory-bound sizes.
+
+template<class T, class F>
+void measure(char const* name, std::string const& suffix, std::size_t n, std::vector<T> const& keys, F contains)
+{
+    double ns = stx_bench::time_per_op(keys.size(), [&]
+    {
+        std::size_t found = 0;
+        for (T k : keys)
+            found += contains(k);
+        stx_bench::keep(found);
+    });
+    stx_bench::report((name + suffix).c_str(), n, ns);
+}
+
+template<class T>
+void run(char const* type, std::size_t n, std::size_t lookups)
+{
+    std::mt19937_64 rng(n);
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i != n; ++i)
+        v[i] = T(i * 3);
+    std::vector<T> keys(lookups);
+    for (T& k : keys)
+        k = T(rng() % (n * 3));
+    stx::eytzinger_set<T> eytzinger(v.begin(), v.end());
+    stx::static_btree_set<T> btree(v.begin(), v.end());
+
+    std::string suffix = std::string(" ") + type;
+    measure("std::lower_bound", suffix, n, keys, [&](T k)
+    {
+        auto it = std::lower_bound(v.begin(), v.end(), k);
+        return it != v.end() && !(k < *it);
+    });
+    measure("stx::binary_search", suffix, n, keys, [&](T k)
+    {
+        return stx::binary_search(v.begin(), v.end(), k) != v.end();
+    });
+    measure("eytzinger_set", suffix, n, keys, [&](T k) { return eytzinger.contains(k); });
+    measure("static_btree_set", suffix, n, keys, [&](T k) { return btree.contains(k); });
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max = stx_bench::arg(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t lookups = stx_bench::arg(argc, argv, 2, 1000000);
+    for (std::size_t n = 1024; n <= max; n *= 8)
+    {
+        run<std::int32_t>("int32", n, lookups);
+        run<std::int64_t>("int64", n, lookups);
+    }
+}
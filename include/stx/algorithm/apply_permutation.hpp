@@ -7,33 +7,413 @@
 #ifndef STX_ALGORITHM_APPLY_PERMUTATION_HPP_INCLUDED
 #define STX_ALGORITHM_APPLY_PERMUTATION_HPP_INCLUDED
 
+#include <new>
+#include <memory>
+#include <tuple>
+#include <thread>
+#include <vector>
+#include <cstddef>
 #include <utility>
 #include <iterator>
+#include <type_traits>
+#include <stx/utility/prefetch.hpp>
 
-namespace stx
+namespace stx { namespace apply_permutation_detail
 {
-    template<class RandValueIt, class RandIndexIt>
-    void apply_permutation(RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it)
+    // How many elements ahead the gathers prefetch their sources.
+    constexpr std::size_t prefetch_distance = 16;
+
+    // Below this, threads cost more than they save.
+    constexpr std::size_t parallel_threshold = 1 << 16;
+
+    template<class RandIt>
+    inline void prefetch_at(RandIt it, std::true_type) noexcept
+    {
+        prefetch(std::addressof(*it));
+    }
+
+    template<class RandIt>
+    inline void prefetch_at(RandIt, std::false_type) noexcept {}
+
+    // Call `put(i, val_it[idx_it[i]])` for i in [0, n), prefetching the
+    // random reads ahead; the writes are sequential.
+    template<class RandValueIt, class RandIndexIt, class Put>
+    void gather(RandValueIt val_it, RandIndexIt idx_it, std::size_t n, Put put)
+    {
+        using can_prefetch = std::is_lvalue_reference<typename std::iterator_traits<RandValueIt>::reference>;
+        std::size_t i = 0;
+        if (n > prefetch_distance)
+        {
+            for (; i != prefetch_distance; ++i)
+                prefetch_at(val_it + idx_it[i], can_prefetch());
+            for (i = 0; i != n - prefetch_distance; ++i)
+            {
+                prefetch_at(val_it + idx_it[i + prefetch_distance], can_prefetch());
+                put(i, std::move(val_it[idx_it[i]]));
+            }
+        }
+        for (; i != n; ++i)
+            put(i, std::move(val_it[idx_it[i]]));
+    }
+
+    // Run `f(first, last)` over `threads` slices of [0, n), one on the
+    // calling thread. A slice whose thread cannot be started runs here.
+    template<class F>
+    void parallel_for(std::size_t n, unsigned threads, F const& f) noexcept
+    {
+        std::vector<std::thread> pool;
+        try
+        {
+            pool.reserve(threads - 1);
+        }
+        catch (...) {}
+        std::size_t const step = n / threads;
+        for (unsigned t = 1; t != threads; ++t)
+        {
+            std::size_t first = step * t;
+            std::size_t last = t + 1 == threads? n : first + step;
+            try
+            {
+                pool.emplace_back([&f, first, last]
+                {
+                    f(first, last);
+                });
+            }
+            catch (...)
+            {
+                f(first, last);
+            }
+        }
+        f(0, step);
+        for (auto& thread : pool)
+            thread.join();
+    }
+
+    using swallow = int[];
+
+    // Marks the visited positions by making them fixed points.
+    template<class RandIndexIt>
+    struct mark_index
     {
         using D = typename std::iterator_traits<RandIndexIt>::value_type;
-        D count = D(val_end - val_it);
-        for (D i = 0; i != count; ++i)
+
+        bool done(std::size_t) const noexcept
+        {
+            return false;
+        }
+
+        void mark(std::size_t i) const
         {
-            D next = idx_it[i];
+            idx_it[i] = D(i);
+        }
+
+        RandIndexIt idx_it;
+    };
+
+    // Marks the visited positions in a bitset of its own.
+    struct mark_bits
+    {
+        explicit mark_bits(std::size_t n) : bits(n) {}
+
+        bool done(std::size_t i) const noexcept
+        {
+            return bits[i];
+        }
+
+        void mark(std::size_t i)
+        {
+            bits[i] = true;
+        }
+
+        std::vector<bool> bits;
+    };
+
+    template<class Tuple, class... RandValueIts, std::size_t... I>
+    inline void restore(Tuple& tmp, std::size_t i, std::index_sequence<I...>, RandValueIts... val_its)
+    {
+        (void)swallow{0, (val_its[i] = std::move(std::get<I>(tmp)), 0)...};
+    }
+
+    // Rotate each cycle of the permutation once, moving the elements of all
+    // the ranges along.
+    template<class RandIndexIt, class Visit, class... RandValueIts>
+    void walk_cycles(RandIndexIt idx_it, std::size_t count, Visit visit, RandValueIts... val_its)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (visit.done(i))
+                continue;
+            std::size_t next = std::size_t(idx_it[i]);
             if (next == i)
                 continue;
-            auto tmp(std::move(val_it[i]));
-            D curr = i;
+            std::tuple<typename std::iterator_traits<RandValueIts>::value_type...> tmp(std::move(val_its[i])...);
+            std::size_t curr = i;
             do
             {
-                val_it[curr] = std::move(val_it[next]);
-                idx_it[curr] = curr;
+                (void)swallow{0, (val_its[curr] = std::move(val_its[next]), 0)...};
+                visit.mark(curr);
                 curr = next;
-                next = idx_it[curr];
+                next = std::size_t(idx_it[curr]);
             } while (next != i);
-            val_it[curr] = std::move(tmp);
-            idx_it[curr] = curr;
+            restore(tmp, curr, std::index_sequence_for<RandValueIts...>(), val_its...);
+            visit.mark(curr);
+        }
+    }
+
+    template<class T>
+    struct buffer_deleter
+    {
+        void operator()(T* p) const noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        std::size_t n;
+    };
+
+    template<class T>
+    using buffer = std::unique_ptr<T, buffer_deleter<T>>;
+
+    template<class T>
+    inline buffer<T> try_allocate(std::size_t n) noexcept
+    {
+        try
+        {
+            return buffer<T>(std::allocator<T>().allocate(n), {n});
+        }
+        catch (std::bad_alloc const&)
+        {
+            return buffer<T>(nullptr, {n});
+        }
+    }
+
+    // The blocked permutation works on blocks of about this many bytes of
+    // values, so that a block stays in the L2 cache.
+    constexpr std::size_t block_bytes = 1 << 18;
+
+    // With more bytes of values than this, the blocked permutation beats
+    // following the cycles, as long as the values are small: it moves each
+    // value three times where the cycles move it once.
+    constexpr std::size_t blocked_threshold = 1 << 22;
+    constexpr std::size_t blocked_max_value_size = 32;
+
+    template<class T>
+    constexpr unsigned block_shift(std::size_t n = block_bytes / sizeof(T), unsigned shift = 0) noexcept
+    {
+        return n > 1? block_shift<T>(n / 2, shift + 1) : shift < 6? 6 : shift;
+    }
+
+    template<class D>
+    struct request
+    {
+        D dst;
+        D src;
+    };
+
+    template<class D, class T>
+    struct entry
+    {
+        D dst;
+        T value;
+    };
+
+    // Permute in two passes over the data that each write to one bucket per
+    // block: the requests are sorted by source block, then the values they
+    // fetch from the cached source block are sorted by destination block,
+    // from where they are stored within the cached destination block.
+    // In a permutation each block is the source and the destination of
+    // exactly a block's worth of elements, so the buckets need no counting.
+    //
+    // Returns false if the buffers cannot be allocated.
+    template<class RandValueIt, class RandIndexIt>
+    bool permute_blocked(RandValueIt val_it, std::size_t n, RandIndexIt idx_it)
+    {
+        using T = typename std::iterator_traits<RandValueIt>::value_type;
+        using D = typename std::iterator_traits<RandIndexIt>::value_type;
+        constexpr unsigned shift = block_shift<T>();
+        std::size_t const blocks = (n >> shift) + 1;
+        auto requests = try_allocate<request<D>>(n);
+        auto entries = try_allocate<entry<D, T>>(n);
+        auto heads = try_allocate<std::size_t>(blocks);
+        if (!requests || !entries || !heads)
+            return false;
+        std::size_t* const head = heads.get();
+
+        for (std::size_t b = 0; b != blocks; ++b)
+            head[b] = b << shift;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            D src = idx_it[i];
+            ::new(static_cast<void*>(requests.get() + head[std::size_t(src) >> shift]++)) request<D>{D(i), src};
+        }
+
+        for (std::size_t b = 0; b != blocks; ++b)
+            head[b] = b << shift;
+        for (request<D> const* r = requests.get(), *end = r + n; r != end; ++r)
+        {
+            ::new(static_cast<void*>(entries.get() + head[std::size_t(r->dst) >> shift]++))
+                entry<D, T>{r->dst, std::move(val_it[r->src])};
         }
+
+        for (entry<D, T>* e = entries.get(), *end = e + n; e != end; ++e)
+        {
+            val_it[e->dst] = std::move(e->value);
+            e->~entry();
+        }
+        for (std::size_t i = 0; i != n; ++i)
+            idx_it[i] = D(i);
+        return true;
+    }
+}}
+
+namespace stx
+{
+    /// Tag to leave the index untouched, at the cost of a bit per element.
+    struct preserve_index_t {};
+
+    constexpr preserve_index_t preserve_index{};
+
+    /// Reorder [val_it, val_end) so that the element at `i` is the one
+    /// formerly at `idx_it[i]`, resetting the indices to the identity.
+    template<class RandValueIt, class RandIndexIt>
+    void apply_permutation(RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it)
+    {
+        apply_permutation_detail::walk_cycles(idx_it, std::size_t(val_end - val_it),
+            apply_permutation_detail::mark_index<RandIndexIt>{idx_it}, val_it);
+    }
+
+    /// Like above, but the indices are kept intact.
+    template<class RandValueIt, class RandIndexIt>
+    void apply_permutation(preserve_index_t, RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it)
+    {
+        std::size_t const n = std::size_t(val_end - val_it);
+        apply_permutation_detail::walk_cycles(idx_it, n, apply_permutation_detail::mark_bits(n), val_it);
+    }
+
+    /// Apply the permutation [idx_it, idx_end) to each of the ranges
+    /// starting at `val_its`, e.g. the columns of a table, in a single walk
+    /// over the cycles. The indices are reset to the identity.
+    template<class RandIndexIt, class... RandValueIts>
+    void apply_permutation_columns(RandIndexIt idx_it, RandIndexIt idx_end, RandValueIts... val_its)
+    {
+        apply_permutation_detail::walk_cycles(idx_it, std::size_t(idx_end - idx_it),
+            apply_permutation_detail::mark_index<RandIndexIt>{idx_it}, val_its...);
+    }
+
+    /// Like above, but the indices are kept intact.
+    template<class RandIndexIt, class... RandValueIts>
+    void apply_permutation_columns(preserve_index_t, RandIndexIt idx_it, RandIndexIt idx_end, RandValueIts... val_its)
+    {
+        std::size_t const n = std::size_t(idx_end - idx_it);
+        apply_permutation_detail::walk_cycles(idx_it, n, apply_permutation_detail::mark_bits(n), val_its...);
+    }
+
+    /// Tag to apply a permutation in cache-sized blocks, see below.
+    struct cache_blocked_t {};
+
+    constexpr cache_blocked_t cache_blocked{};
+
+    /// Tag to apply a permutation in cache-sized blocks if the range is
+    /// well out of the L2 cache and the values are small, and by following
+    /// the cycles otherwise.
+    struct cache_adaptive_t {};
+
+    constexpr cache_adaptive_t cache_adaptive{};
+
+    /// Like `apply_permutation`, but instead of following the cycles, with
+    /// a cache miss per element once the range is out of the cache, the
+    /// elements are distributed in two bucketing passes that only access
+    /// memory sequentially or within cache-sized blocks. It takes buffers
+    /// for the elements and two indices per element.
+    ///
+    /// Falls back to following the cycles if the buffers cannot be
+    /// allocated. The value type must be nothrow move-constructible and
+    /// assignable.
+    template<class RandValueIt, class RandIndexIt>
+    void apply_permutation(cache_blocked_t, RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it)
+    {
+        using T = typename std::iterator_traits<RandValueIt>::value_type;
+        static_assert(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+            "value type must be nothrow movable");
+        if (!apply_permutation_detail::permute_blocked(val_it, std::size_t(val_end - val_it), idx_it))
+            apply_permutation(val_it, val_end, idx_it);
+    }
+
+    template<class RandValueIt, class RandIndexIt>
+    void apply_permutation(cache_adaptive_t, RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it)
+    {
+        using T = typename std::iterator_traits<RandValueIt>::value_type;
+        if (sizeof(T) <= apply_permutation_detail::blocked_max_value_size &&
+            std::size_t(val_end - val_it) * sizeof(T) > apply_permutation_detail::blocked_threshold)
+            apply_permutation(cache_blocked, val_it, val_end, idx_it);
+        else
+            apply_permutation(val_it, val_end, idx_it);
+    }
+
+    /// Write the elements of [val_it, val_end) to `out` in the order given
+    /// by the indices, i.e. `out[i] = std::move(val_it[idx_it[i]])`,
+    /// leaving the source moved-from and the indices unchanged.
+    ///
+    /// Unlike the in-place version, which chases the cycles one dependent
+    /// access at a time, the reads are independent and prefetched ahead.
+    template<class RandValueIt, class RandIndexIt, class OutIt>
+    OutIt apply_permutation_to(RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it, OutIt out)
+    {
+        apply_permutation_detail::gather(val_it, idx_it, std::size_t(val_end - val_it), [&out](std::size_t, auto&& val)
+        {
+            *out = std::forward<decltype(val)>(val);
+            ++out;
+        });
+        return out;
+    }
+
+    /// Like `apply_permutation`, but on up to `threads` threads, e.g.
+    /// `std::thread::hardware_concurrency()`. The elements are
+    /// gathered into a temporary buffer and moved back, each step split
+    /// evenly among the threads, so it takes memory for another copy of
+    /// the range. The indices are reset to the identity as well.
+    ///
+    /// Falls back to the sequential version for small ranges, or if the
+    /// buffer cannot be allocated.
+    /// The value type must be nothrow move-constructible and assignable.
+    template<class RandValueIt, class RandIndexIt>
+    void apply_permutation(RandValueIt val_it, RandValueIt val_end, RandIndexIt idx_it, unsigned threads)
+    {
+        using T = typename std::iterator_traits<RandValueIt>::value_type;
+        using D = typename std::iterator_traits<RandIndexIt>::value_type;
+        static_assert(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+            "value type must be nothrow movable");
+        std::size_t const n = std::size_t(val_end - val_it);
+        if (threads > n / apply_permutation_detail::parallel_threshold)
+            threads = unsigned(n / apply_permutation_detail::parallel_threshold);
+        T* p = nullptr;
+        if (threads > 1)
+        {
+            try
+            {
+                p = std::allocator<T>().allocate(n);
+            }
+            catch (std::bad_alloc const&) {}
+        }
+        if (!p)
+            return apply_permutation(val_it, val_end, idx_it);
+        std::unique_ptr<T, apply_permutation_detail::buffer_deleter<T>> buf(p, {n});
+        apply_permutation_detail::parallel_for(n, threads, [=](std::size_t first, std::size_t last)
+        {
+            apply_permutation_detail::gather(val_it, idx_it + first, last - first, [p, first](std::size_t i, T&& val)
+            {
+                ::new(static_cast<void*>(p + first + i)) T(std::move(val));
+            });
+        });
+        apply_permutation_detail::parallel_for(n, threads, [=](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i != last; ++i)
+            {
+                val_it[i] = std::move(p[i]);
+                p[i].~T();
+                idx_it[i] = D(i);
+            }
+        });
     }
 }
 
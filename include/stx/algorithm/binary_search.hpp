@@ -7,17 +7,351 @@
 #ifndef STX_ALGORITHM_BINARY_SEARCH_HPP_INCLUDED
 #define STX_ALGORITHM_BINARY_SEARCH_HPP_INCLUDED
 
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <iterator>
 #include <functional>
+#include <type_traits>
+#include <stx/utility/prefetch.hpp>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define STX_ALGORITHM_HAS_SSE2
+#if defined(__AVX2__)
+#define STX_ALGORITHM_HAS_AVX2
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define STX_ALGORITHM_HAS_AVX2
+#define STX_ALGORITHM_DISPATCH_AVX2
+#endif
+#endif
 
-namespace stx
+namespace stx { namespace binary_search_detail
 {
+    template<class T>
+    struct is_key : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {};
+
+    template<class Cmp, class T>
+    struct is_less : std::false_type {};
+
+    template<class T>
+    struct is_less<std::less<>, T> : std::true_type {};
+
+    template<class T>
+    struct is_less<std::less<T>, T> : std::true_type {};
+
+    template<class T>
+    struct is_char
+      : std::integral_constant<bool,
+            std::is_same<T, char>::value || std::is_same<T, wchar_t>::value ||
+            std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value>
+    {};
+
+    // Iterators known to address contiguous storage, so that the elements
+    // can be searched through plain pointers. Before C++20 that is pointers,
+    // which includes `array_view` and usually `std::array`, and the
+    // iterators of `std::vector` and `std::basic_string`.
+    template<class It, class V>
+    struct is_contiguous
+      : std::integral_constant<bool,
+#if defined(__cpp_lib_concepts)
+            std::contiguous_iterator<It> ||
+#endif
+            std::is_pointer<It>::value ||
+            std::is_same<It, typename std::vector<V>::iterator>::value ||
+            std::is_same<It, typename std::vector<V>::const_iterator>::value ||
+            std::is_same<It, typename std::conditional<is_char<V>::value, std::basic_string<V>, std::vector<V>>::type::iterator>::value ||
+            std::is_same<It, typename std::conditional<is_char<V>::value, std::basic_string<V>, std::vector<V>>::type::const_iterator>::value>
+    {};
+
+    // Contiguous ranges of arithmetic keys searched with `std::less` for a
+    // key of the same type take the branchless path.
+    template<class RandIt, class T, class Cmp, class V = typename std::iterator_traits<RandIt>::value_type, bool = is_key<V>::value>
+    struct is_fast : std::false_type {};
+
+    template<class RandIt, class T, class Cmp, class V>
+    struct is_fast<RandIt, T, Cmp, V, true>
+      : std::integral_constant<bool,
+            std::is_same<V, T>::value &&
+            is_less<typename std::decay<Cmp>::type, T>::value &&
+            is_contiguous<RandIt, V>::value>
+    {};
+
+    // The size of the final window scanned linearly: 128 bytes.
+    template<class T>
+    constexpr std::size_t window() noexcept
+    {
+        return 128 / sizeof(T) < 8? 8 : 128 / sizeof(T);
+    }
+
+    // Count the elements less than `val` in the window starting at `p`.
+    template<class T>
+    inline std::size_t count_less_scalar(T const* p, T val) noexcept
+    {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i != window<T>(); ++i)
+            n += p[i] < val;
+        return n;
+    }
+
+#if defined(STX_ALGORITHM_HAS_SSE2)
+    inline std::size_t sum_lanes32(__m128i acc) noexcept
+    {
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        return std::size_t(_mm_cvtsi128_si32(acc));
+    }
+
+    inline std::size_t sum_lanes64(__m128i acc) noexcept
+    {
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi64(acc, acc));
+        return std::size_t(_mm_cvtsi128_si32(acc));
+    }
+
+    // The comparison masks are -1 for true, so subtracting them counts.
+    inline std::size_t count_less_sse2(std::int32_t const* p, std::int32_t val) noexcept
+    {
+        __m128i const v = _mm_set1_epi32(val);
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t i = 0; i != window<std::int32_t>(); i += 4)
+            acc = _mm_sub_epi32(acc, _mm_cmplt_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), v));
+        return sum_lanes32(acc);
+    }
+
+    inline std::size_t count_less_sse2(std::uint32_t const* p, std::uint32_t val) noexcept
+    {
+        // Flip the sign bits to compare as signed.
+        __m128i const bias = _mm_set1_epi32(INT32_MIN);
+        __m128i const v = _mm_xor_si128(_mm_set1_epi32(std::int32_t(val)), bias);
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t i = 0; i != window<std::uint32_t>(); i += 4)
+        {
+            __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), bias);
+            acc = _mm_sub_epi32(acc, _mm_cmplt_epi32(x, v));
+        }
+        return sum_lanes32(acc);
+    }
+
+    inline std::size_t count_less_sse2(float const* p, float val) noexcept
+    {
+        __m128 const v = _mm_set1_ps(val);
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t i = 0; i != window<float>(); i += 4)
+            acc = _mm_sub_epi32(acc, _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(p + i), v)));
+        return sum_lanes32(acc);
+    }
+
+    // 64-bit integers need SSE4.2 for the comparison.
+    inline std::size_t count_less_sse2(std::int64_t const* p, std::int64_t val) noexcept
+    {
+#if defined(__SSE4_2__)
+        __m128i const v = _mm_set1_epi64x(val);
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t i = 0; i != window<std::int64_t>(); i += 2)
+            acc = _mm_sub_epi64(acc, _mm_cmpgt_epi64(v, _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i))));
+        return sum_lanes64(acc);
+#else
+        return count_less_scalar(p, val);
+#endif
+    }
+
+    inline std::size_t count_less_sse2(std::uint64_t const* p, std::uint64_t val) noexcept
+    {
+#if defined(__SSE4_2__)
+        __m128i const bias = _mm_set1_epi64x(INT64_MIN);
+        __m128i const v = _mm_xor_si128(_mm_set1_epi64x(std::int64_t(val)), bias);
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t i = 0; i != window<std::uint64_t>(); i += 2)
+        {
+            __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), bias);
+            acc = _mm_sub_epi64(acc, _mm_cmpgt_epi64(v, x));
+        }
+        return sum_lanes64(acc);
+#else
+        return count_less_scalar(p, val);
+#endif
+    }
+
+    inline std::size_t count_less_sse2(double const* p, double val) noexcept
+    {
+        __m128d const v = _mm_set1_pd(val);
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t i = 0; i != window<double>(); i += 2)
+            acc = _mm_sub_epi64(acc, _mm_castpd_si128(_mm_cmplt_pd(_mm_loadu_pd(p + i), v)));
+        return sum_lanes64(acc);
+    }
+#endif
+
+#if defined(STX_ALGORITHM_HAS_AVX2)
+#if defined(STX_ALGORITHM_DISPATCH_AVX2)
+#define STX_ALGORITHM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define STX_ALGORITHM_TARGET_AVX2
+#endif
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t sum_lanes32(__m256i acc) noexcept
+    {
+        return sum_lanes32(_mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1)));
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t sum_lanes64(__m256i acc) noexcept
+    {
+        return sum_lanes64(_mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1)));
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t count_less_avx2(std::int32_t const* p, std::int32_t val) noexcept
+    {
+        __m256i const v = _mm256_set1_epi32(val);
+        __m256i acc = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != window<std::int32_t>(); i += 8)
+            acc = _mm256_sub_epi32(acc, _mm256_cmpgt_epi32(v, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + i))));
+        return sum_lanes32(acc);
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t count_less_avx2(std::uint32_t const* p, std::uint32_t val) noexcept
+    {
+        __m256i const bias = _mm256_set1_epi32(INT32_MIN);
+        __m256i const v = _mm256_xor_si256(_mm256_set1_epi32(std::int32_t(val)), bias);
+        __m256i acc = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != window<std::uint32_t>(); i += 8)
+        {
+            __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + i)), bias);
+            acc = _mm256_sub_epi32(acc, _mm256_cmpgt_epi32(v, x));
+        }
+        return sum_lanes32(acc);
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t count_less_avx2(float const* p, float val) noexcept
+    {
+        __m256 const v = _mm256_set1_ps(val);
+        __m256i acc = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != window<float>(); i += 8)
+            acc = _mm256_sub_epi32(acc, _mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_LT_OQ)));
+        return sum_lanes32(acc);
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t count_less_avx2(std::int64_t const* p, std::int64_t val) noexcept
+    {
+        __m256i const v = _mm256_set1_epi64x(val);
+        __m256i acc = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != window<std::int64_t>(); i += 4)
+            acc = _mm256_sub_epi64(acc, _mm256_cmpgt_epi64(v, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + i))));
+        return sum_lanes64(acc);
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t count_less_avx2(std::uint64_t const* p, std::uint64_t val) noexcept
+    {
+        __m256i const bias = _mm256_set1_epi64x(INT64_MIN);
+        __m256i const v = _mm256_xor_si256(_mm256_set1_epi64x(std::int64_t(val)), bias);
+        __m256i acc = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != window<std::uint64_t>(); i += 4)
+        {
+            __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + i)), bias);
+            acc = _mm256_sub_epi64(acc, _mm256_cmpgt_epi64(v, x));
+        }
+        return sum_lanes64(acc);
+    }
+
+    STX_ALGORITHM_TARGET_AVX2
+    inline std::size_t count_less_avx2(double const* p, double val) noexcept
+    {
+        __m256d const v = _mm256_set1_pd(val);
+        __m256i acc = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != window<double>(); i += 4)
+            acc = _mm256_sub_epi64(acc, _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(p + i), v, _CMP_LT_OQ)));
+        return sum_lanes64(acc);
+    }
+#undef STX_ALGORITHM_TARGET_AVX2
+
+    inline bool has_avx2() noexcept
+    {
+#if defined(STX_ALGORITHM_DISPATCH_AVX2)
+        static bool const value = __builtin_cpu_supports("avx2");
+        return value;
+#else
+        return true;
+#endif
+    }
+#endif
+
+    template<class T>
+    struct has_simd
+      : std::integral_constant<bool,
+            std::is_same<T, std::int32_t>::value || std::is_same<T, std::uint32_t>::value ||
+            std::is_same<T, std::int64_t>::value || std::is_same<T, std::uint64_t>::value ||
+            std::is_same<T, float>::value || std::is_same<T, double>::value>
+    {};
+
+    template<class T>
+    inline std::size_t count_less(T const* p, T val, std::false_type) noexcept
+    {
+        return count_less_scalar(p, val);
+    }
+
+    template<class T>
+    inline std::size_t count_less(T const* p, T val, std::true_type) noexcept
+    {
+#if defined(STX_ALGORITHM_HAS_AVX2)
+        if (has_avx2())
+            return count_less_avx2(p, val);
+#endif
+#if defined(STX_ALGORITHM_HAS_SSE2)
+        return count_less_sse2(p, val);
+#else
+        return count_less_scalar(p, val);
+#endif
+    }
+
+    // Branchless bisection down to a window, which is then counted with
+    // SIMD. Finds the first element not less than `val`, so the result is
+    // the leftmost of equal elements.
+    template<class E, class T>
+    E* search(E* first, E* last, T val) noexcept
+    {
+        constexpr std::size_t w = window<T>();
+        std::size_t len = std::size_t(last - first);
+        E* base = first;
+        if (len < w)
+        {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i != len; ++i)
+                n += first[i] < val;
+            base += n;
+        }
+        else
+        {
+            while (len > w)
+            {
+                std::size_t half = len / 2;
+                // Without branches nothing is loaded speculatively, so fetch
+                // both of the next probes while this one is pending.
+                prefetch(base + half / 2);
+                prefetch(base + half + half / 2);
+                base += (base[half] < val) * half;
+                len -= half;
+            }
+            // Widen the window to its full size, staying in bounds.
+            if (base > last - w)
+                base = last - w;
+            base += count_less(static_cast<T const*>(base), val, has_simd<T>());
+        }
+        return base != last && !(val < *base)? base : last;
+    }
+
     template<class RandIt, class T, class Cmp>
-    RandIt binary_search(RandIt first, RandIt last, T const& val, Cmp&& cmp)
+    RandIt search(RandIt first, RandIt last, T const& val, Cmp& cmp, std::false_type)
     {
         RandIt not_found(last);
         while (first != last)
         {
-            RandIt it(first + (last - first >> 1));
+            RandIt it(first + ((last - first) >> 1));
             if (cmp(val, *it))
                 last = it;
             else if (cmp(*it, val))
@@ -28,10 +362,106 @@ namespace stx
         return not_found;
     }
 
+    template<class RandIt, class T, class Cmp>
+    inline RandIt search(RandIt first, RandIt last, T const& val, Cmp&, std::true_type)
+    {
+        if (first == last)
+            return last;
+        auto const p = std::addressof(*first);
+        return first + (search(p, p + (last - first), val) - p);
+    }
+
+    template<class RandIt>
+    inline void prefetch_at(RandIt it, std::true_type) noexcept
+    {
+        prefetch(std::addressof(*it));
+    }
+
+    template<class RandIt>
+    inline void prefetch_at(RandIt, std::false_type) noexcept {}
+
+    // Run branchless lower-bound searches for `m` keys side by side. They
+    // all halve the same length at each step, so their probes are issued
+    // together and the cache misses overlap.
+    template<class RandIt, class KeyIt, class Cmp>
+    void search_group(RandIt first, RandIt last, KeyIt const* keys, std::size_t m, RandIt* result, Cmp& cmp)
+    {
+        using diff_t = typename std::iterator_traits<RandIt>::difference_type;
+        using can_prefetch = std::is_lvalue_reference<typename std::iterator_traits<RandIt>::reference>;
+        RandIt* const base = result;
+        for (std::size_t g = 0; g != m; ++g)
+            base[g] = first;
+        std::size_t len = std::size_t(last - first);
+        if (!len)
+            return;
+        while (len > 1)
+        {
+            std::size_t half = len / 2;
+            for (std::size_t g = 0; g != m; ++g)
+                prefetch_at(base[g] + diff_t(half), can_prefetch());
+            for (std::size_t g = 0; g != m; ++g)
+                base[g] += diff_t(bool(cmp(base[g][diff_t(half)], *keys[g])) * half);
+            len -= half;
+        }
+        for (std::size_t g = 0; g != m; ++g)
+        {
+            RandIt it = base[g] + diff_t(bool(cmp(*base[g], *keys[g])));
+            result[g] = it != last && !cmp(*keys[g], *it)? it : last;
+        }
+    }
+}}
+
+namespace stx
+{
+    /// Return an iterator to an element equivalent to `val`, or `last`.
+    ///
+    /// For contiguous ranges of arithmetic keys searched with `std::less`
+    /// for a key of the same type, a branchless bisection is used and the
+    /// final window is counted with SSE2/AVX2, picked at runtime where
+    /// possible; 64-bit integers need AVX2 or SSE4.2.
+    template<class RandIt, class T, class Cmp>
+    RandIt binary_search(RandIt first, RandIt last, T const& val, Cmp&& cmp)
+    {
+        return binary_search_detail::search(first, last, val, cmp, binary_search_detail::is_fast<RandIt, T, Cmp>());
+    }
+
     template<class RandIt, class T>
     inline RandIt binary_search(RandIt first, RandIt last, T const& val)
     {
-        return binary_search(first, last, val, std::less<>{});
+        return stx::binary_search(first, last, val, std::less<>{});
+    }
+
+    /// Search [first, last) for each key in [keys_first, keys_last) as by
+    /// `binary_search`, writing the resulting iterators to `out`. `KeyIt`
+    /// must be a forward iterator.
+    ///
+    /// `Group` searches advance in lock-step, with the probes of each step
+    /// prefetched before they are compared, so that their cache misses are
+    /// served in parallel rather than one after another. This pays off when
+    /// the range does not fit in the cache.
+    template<std::size_t Group = 16, class RandIt, class KeyIt, class OutIt, class Cmp>
+    OutIt binary_search_batch(RandIt first, RandIt last, KeyIt keys_first, KeyIt keys_last, OutIt out, Cmp&& cmp)
+    {
+        static_assert(Group > 0, "empty group");
+        KeyIt keys[Group];
+        RandIt result[Group];
+        while (keys_first != keys_last)
+        {
+            std::size_t m = 0;
+            do
+                keys[m++] = keys_first++;
+            while (m != Group && keys_first != keys_last);
+            binary_search_detail::search_group(first, last, keys, m, result, cmp);
+            for (std::size_t g = 0; g != m; ++g)
+                *out++ = result[g];
+        }
+        return out;
+    }
+
+    template<std::size_t Group = 16, class RandIt, class KeyIt, class OutIt>
+    inline OutIt binary_search_batch(RandIt first, RandIt last, KeyIt keys_first, KeyIt keys_last, OutIt out)
+    {
+        return stx::binary_search_batch<Group>(first, last, keys_first, keys_last, out, std::less<>{});
     }
 }
 
@@ -0,0 +1,279 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_CONTAINER_EYTZINGER_SET_HPP_INCLUDED
+#define STX_CONTAINER_EYTZINGER_SET_HPP_INCLUDED
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <initializer_list>
+#include <stx/utility/prefetch.hpp>
+
+namespace stx { namespace eytzinger_set_detail
+{
+    inline unsigned trailing_ones(std::size_t k) noexcept
+    {
+#if defined(__GNUC__)
+        return unsigned(__builtin_ctzll(~static_cast<unsigned long long>(k)));
+#else
+        unsigned n = 0;
+        for (; k & 1; k >>= 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    constexpr std::size_t floor_pow2(std::size_t n) noexcept
+    {
+        return n < 2? n : 2 * floor_pow2(n / 2);
+    }
+}}
+
+namespace stx
+{
+    /// An immutable sorted set in the Eytzinger (BFS) layout: node `k` has
+    /// its children at `2k` and `2k + 1`, so the first levels of every search
+    /// share the same few cache lines, and the descendants a few levels
+    /// down are contiguous and can be prefetched while descending.
+    ///
+    /// Built once from a sorted range. Iteration is in sorted order.
+    /// `T` must be default-constructible.
+    template<class T, class Compare = std::less<T>, class Allocator = std::allocator<T>>
+    class eytzinger_set
+    {
+        // 1-based, `_tree[0]` is unused and index 0 means none.
+        std::vector<T, Allocator> _tree;
+        Compare _comp;
+
+        // The descendants of node `k` log2(prefetch_stride) levels down
+        // start at `k * prefetch_stride` and fit in a cache line.
+        static constexpr std::size_t prefetch_stride = eytzinger_set_detail::floor_pow2(64 / sizeof(T));
+
+    public:
+
+        using key_type = T;
+        using value_type = T;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T const&;
+        using const_reference = T const&;
+
+        class const_iterator
+        {
+            friend class eytzinger_set;
+
+            T const* _tree;
+            std::size_t _n;
+            std::size_t _k;
+
+            const_iterator(T const* tree, std::size_t n, std::size_t k) noexcept
+              : _tree(tree), _n(n), _k(k)
+            {}
+
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T const*;
+            using reference = T const&;
+
+            const_iterator() noexcept : _tree(), _n(), _k() {}
+
+            reference operator*() const noexcept
+            {
+                return _tree[_k];
+            }
+
+            pointer operator->() const noexcept
+            {
+                return _tree + _k;
+            }
+
+            // The successor is the leftmost node of the right subtree, or
+            // else the parent of the nearest ancestor that is a left child.
+            const_iterator& operator++() noexcept
+            {
+                if (2 * _k + 1 <= _n)
+                {
+                    _k = 2 * _k + 1;
+                    while (2 * _k <= _n)
+                        _k *= 2;
+                }
+                else
+                    _k >>= eytzinger_set_detail::trailing_ones(_k) + 1;
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                const_iterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            const_iterator& operator--() noexcept
+            {
+                if (!_k)
+                    _k = rightmost(1);
+                else if (2 * _k <= _n)
+                    _k = rightmost(2 * _k);
+                else
+                {
+                    while (!(_k & 1))
+                        _k >>= 1;
+                    _k >>= 1;
+                }
+                return *this;
+            }
+
+            const_iterator operator--(int) noexcept
+            {
+                const_iterator tmp(*this);
+                --*this;
+                return tmp;
+            }
+
+            friend bool operator==(const_iterator const& a, const_iterator const& b) noexcept
+            {
+                return a._k == b._k;
+            }
+
+            friend bool operator!=(const_iterator const& a, const_iterator const& b) noexcept
+            {
+                return a._k != b._k;
+            }
+
+        private:
+
+            std::size_t rightmost(std::size_t k) const noexcept
+            {
+                while (2 * k + 1 <= _n)
+                    k = 2 * k + 1;
+                return k;
+            }
+        };
+
+        using iterator = const_iterator;
+
+        eytzinger_set() : _tree(1) {}
+
+        /// [first, last) must be sorted by `comp`.
+        template<class ForwardIt>
+        eytzinger_set(ForwardIt first, ForwardIt last, Compare const& comp = Compare(), Allocator const& alloc = Allocator())
+          : _tree(std::size_t(std::distance(first, last)) + 1, alloc), _comp(comp)
+        {
+            build(first, 1);
+        }
+
+        eytzinger_set(std::initializer_list<T> list, Compare const& comp = Compare(), Allocator const& alloc = Allocator())
+          : eytzinger_set(list.begin(), list.end(), comp, alloc)
+        {}
+
+        size_type size() const noexcept
+        {
+            return _tree.size() - 1;
+        }
+
+        bool empty() const noexcept
+        {
+            return _tree.size() == 1;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            std::size_t k = 1;
+            while (2 * k <= size())
+                k *= 2;
+            return make_iterator(empty()? 0 : k);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return make_iterator(0);
+        }
+
+        key_compare key_comp() const
+        {
+            return _comp;
+        }
+
+        const_iterator lower_bound(T const& val) const
+        {
+            return make_iterator(descend(val, [this](T const& key, T const& x)
+            {
+                return _comp(key, x);
+            }));
+        }
+
+        const_iterator upper_bound(T const& val) const
+        {
+            return make_iterator(descend(val, [this](T const& key, T const& x)
+            {
+                return !_comp(x, key);
+            }));
+        }
+
+        const_iterator find(T const& val) const
+        {
+            std::size_t k = descend(val, [this](T const& key, T const& x)
+            {
+                return _comp(key, x);
+            });
+            return make_iterator(k && !_comp(val, _tree[k])? k : 0);
+        }
+
+        bool contains(T const& val) const
+        {
+            return find(val) != end();
+        }
+
+    private:
+
+        const_iterator make_iterator(std::size_t k) const noexcept
+        {
+            return const_iterator(_tree.data(), size(), k);
+        }
+
+        // In-order traversal of the implicit tree, taking the sorted input.
+        template<class ForwardIt>
+        void build(ForwardIt& it, std::size_t k)
+        {
+            if (k < _tree.size())
+            {
+                build(it, 2 * k);
+                _tree[k] = *it;
+                ++it;
+                build(it, 2 * k + 1);
+            }
+        }
+
+        // Go right while `go_right(key, val)`, without branching, then back
+        // up to the last node where we went left.
+        template<class GoRight>
+        std::size_t descend(T const& val, GoRight go_right) const
+        {
+            std::size_t const n = size();
+            T const* tree = _tree.data();
+            std::size_t k = 1;
+            while (k <= n)
+            {
+                if (prefetch_stride > 1 && k * prefetch_stride <= n)
+                    prefetch(tree + k * prefetch_stride);
+                k = 2 * k + go_right(tree[k], val);
+            }
+            return k >> (eytzinger_set_detail::trailing_ones(k) + 1);
+        }
+    };
+}
+
+#endif
\ No newline at end of file
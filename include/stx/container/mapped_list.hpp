@@ -0,0 +1,223 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_CONTAINER_MAPPED_LIST_HPP_INCLUDED
+#define STX_CONTAINER_MAPPED_LIST_HPP_INCLUDED
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stx/container/relocatable_list.hpp>
+
+namespace stx { namespace mapped_list_detail
+{
+    struct header
+    {
+        char magic[8];
+        std::uint32_t value_size;
+        std::uint32_t value_align;
+    };
+
+    constexpr char magic[8] = {'s', 't', 'x', 'l', 'i', 's', 't', '1'};
+
+    [[noreturn]] inline void throw_errno()
+    {
+        throw std::system_error(errno, std::generic_category());
+    }
+}}
+
+namespace stx
+{
+    /// A `relocatable_list` stored in a file mapped with `mmap`. The file can
+    /// be mapped at any address, so a list created by one process can be
+    /// reopened and used by another. Only one mapping may modify the list at a
+    /// time. The layout is not portable across ABIs.
+    template<class T>
+    class mapped_list
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "mapped_list requires trivially copyable elements");
+
+        using header = mapped_list_detail::header;
+        using root_t = relocatable_list<T>;
+
+        static constexpr std::size_t root_offset =
+            (sizeof(header) + alignof(root_t) - 1) / alignof(root_t) * alignof(root_t);
+
+    public:
+
+        using list_type = typename root_t::list_type;
+
+        mapped_list() noexcept : _fd(-1), _base(), _size() {}
+
+        mapped_list(mapped_list&& other) noexcept
+          : _fd(other._fd), _base(other._base), _size(other._size)
+        {
+            other._fd = -1;
+            other._base = nullptr;
+            other._size = 0;
+        }
+
+        mapped_list& operator=(mapped_list&& other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                std::swap(_fd, other._fd);
+                std::swap(_base, other._base);
+                std::swap(_size, other._size);
+            }
+            return *this;
+        }
+
+        ~mapped_list()
+        {
+            close();
+        }
+
+        /// Create (or truncate) the file at `path` with room for `size` bytes.
+        /// \throw std::system_error
+        static mapped_list create(char const* path, std::size_t size)
+        {
+            if (size < root_offset + sizeof(root_t))
+                size = root_offset + sizeof(root_t);
+            mapped_list m;
+            m._fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (m._fd < 0)
+                mapped_list_detail::throw_errno();
+            if (::ftruncate(m._fd, off_t(size)))
+                mapped_list_detail::throw_errno();
+            m.map(size);
+            header* h = m.get_header();
+            std::memcpy(h->magic, mapped_list_detail::magic, sizeof(h->magic));
+            h->value_size = sizeof(T);
+            h->value_align = alignof(T);
+            root_t::create(m._base + root_offset, size - root_offset);
+            return m;
+        }
+
+        /// Open an existing file created by `create`.
+        /// \throw std::system_error
+        static mapped_list open(char const* path)
+        {
+            mapped_list m;
+            m._fd = ::open(path, O_RDWR);
+            if (m._fd < 0)
+                mapped_list_detail::throw_errno();
+            struct stat st;
+            if (::fstat(m._fd, &st))
+                mapped_list_detail::throw_errno();
+            std::size_t size = std::size_t(st.st_size);
+            if (size < root_offset + sizeof(root_t))
+                throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+            m.map(size);
+            header* h = m.get_header();
+            if (std::memcmp(h->magic, mapped_list_detail::magic, sizeof(h->magic)) ||
+                h->value_size != sizeof(T) || h->value_align != alignof(T))
+                throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+            m.root()->set_capacity(size - root_offset);
+            return m;
+        }
+
+        /// Write the modified pages back to the file.
+        /// \throw std::system_error
+        void flush()
+        {
+            if (::msync(_base, _size, MS_SYNC))
+                mapped_list_detail::throw_errno();
+        }
+
+        /// Enlarge the file to `size` bytes and remap it, possibly at another
+        /// address. References and iterators into the list are invalidated.
+        /// \throw std::system_error
+        void grow(std::size_t size)
+        {
+            if (size <= _size)
+                return;
+            if (::ftruncate(_fd, off_t(size)))
+                mapped_list_detail::throw_errno();
+            ::munmap(_base, _size);
+            _base = nullptr;
+            map(size);
+            root()->set_capacity(size - root_offset);
+        }
+
+        void close() noexcept
+        {
+            if (_base)
+            {
+                ::munmap(_base, _size);
+                _base = nullptr;
+                _size = 0;
+            }
+            if (_fd >= 0)
+            {
+                ::close(_fd);
+                _fd = -1;
+            }
+        }
+
+        bool is_open() const noexcept
+        {
+            return _base != nullptr;
+        }
+
+        list_type& list() noexcept
+        {
+            return root()->list();
+        }
+
+        list_type const& list() const noexcept
+        {
+            return root()->list();
+        }
+
+        /// The number of bytes of the file in use.
+        std::size_t size_in_bytes() const noexcept
+        {
+            return root_offset + root()->size_in_bytes();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return _size;
+        }
+
+    private:
+
+        void map(std::size_t size)
+        {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+            if (p == MAP_FAILED)
+                mapped_list_detail::throw_errno();
+            _base = static_cast<char*>(p);
+            _size = size;
+        }
+
+        header* get_header() const noexcept
+        {
+            return reinterpret_cast<header*>(_base);
+        }
+
+        root_t* root() const noexcept
+        {
+            return root_t::from(_base + root_offset);
+        }
+
+        int _fd;
+        char* _base;
+        std::size_t _size;
+    };
+}
+
+#endif
\ No newline at end of file
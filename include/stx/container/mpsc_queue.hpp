@@ -0,0 +1,223 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_CONTAINER_MPSC_QUEUE_HPP_INCLUDED
+#define STX_CONTAINER_MPSC_QUEUE_HPP_INCLUDED
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <stx/container/offset_list.hpp>
+
+namespace stx { namespace mpsc_queue_detail
+{
+    constexpr std::size_t cache_line_size = 64;
+}}
+
+namespace stx
+{
+    /// A lock-free multi-producer/single-consumer FIFO queue. Producers push
+    /// onto a shared stack with a CAS; the consumer takes the whole stack
+    /// with a single exchange and reverses it into a private chain.
+    ///
+    /// `push` and `emplace` may be called from any thread; `try_pop`,
+    /// `consume_all` and `empty` only from one consumer thread at a time.
+    /// The allocator must be usable from all the producer threads.
+    template<class T, class Allocator = std::allocator<T>>
+    class mpsc_queue : offset_list_detail::node_alloc<Allocator, T>
+    {
+        // Nodes form forward chains: `diff` is the offset to the next node,
+        // or 0 at the end of the chain.
+        using node_t = offset_list_detail::node<T>;
+        using node_alloc = offset_list_detail::node_alloc<Allocator, T>;
+        using node_alloc_traits = std::allocator_traits<node_alloc>;
+
+    public:
+
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+
+        mpsc_queue() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+          : mpsc_queue(Allocator())
+        {}
+
+        explicit mpsc_queue(Allocator const& alloc) noexcept
+          : node_alloc(alloc), _back(nullptr), _front(nullptr)
+        {}
+
+        mpsc_queue(mpsc_queue const&) = delete;
+        mpsc_queue& operator=(mpsc_queue const&) = delete;
+
+        ~mpsc_queue()
+        {
+            destroy_chain(_front);
+            destroy_chain(_back.load(std::memory_order_acquire));
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return static_cast<allocator_type const&>(*this);
+        }
+
+        /// \exception-safety strong
+        void push(T const& val)
+        {
+            emplace(val);
+        }
+
+        /// \exception-safety strong
+        void push(T&& val)
+        {
+            emplace(std::move(val));
+        }
+
+        /// \exception-safety strong
+        template<class... Args>
+        void emplace(Args&&... args)
+        {
+            node_t* p = new_node(std::forward<Args>(args)...);
+            node_t* top = _back.load(std::memory_order_relaxed);
+            do
+                set_next(p, top);
+            while (!_back.compare_exchange_weak(top, p, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /// Move the oldest element into `val`, if any.
+        /// \exception-safety basic
+        bool try_pop(T& val)
+        {
+            if (!_front && !(_front = take()))
+                return false;
+            node_t* p = _front;
+            val = std::move(value_of(p));
+            _front = next_of(p);
+            delete_node(p);
+            return true;
+        }
+
+        /// Call `f` with each queued element in FIFO order, taking everything
+        /// pushed so far with one atomic exchange, and return the number of
+        /// elements consumed. If `f` throws, the element it was called with
+        /// is dropped and the rest remain queued.
+        template<class F>
+        size_type consume_all(F&& f)
+        {
+            size_type n = consume_front(f);
+            _front = take();
+            return n + consume_front(f);
+        }
+
+        /// Whether the queue is empty, as of some moment during the call.
+        bool empty() const noexcept
+        {
+            return !_front && !_back.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        struct node_deleter
+        {
+            mpsc_queue* queue;
+            node_t* p;
+
+            ~node_deleter()
+            {
+                queue->delete_node(p);
+            }
+        };
+
+        node_alloc& alloc_base()
+        {
+            return static_cast<node_alloc&>(*this);
+        }
+
+        static T& value_of(node_t* p) noexcept
+        {
+            return *reinterpret_cast<T*>(&p->data);
+        }
+
+        static node_t* next_of(node_t* p) noexcept
+        {
+            using namespace offset_list_detail;
+            return p->diff? advance_in_bytes(p, p->diff) : nullptr;
+        }
+
+        static void set_next(node_t* p, node_t* next) noexcept
+        {
+            using namespace offset_list_detail;
+            p->diff = next? distance_in_bytes(p, next) : 0;
+        }
+
+        template<class... Ts>
+        node_t* new_node(Ts&&... ts)
+        {
+            node_t* p = node_alloc_traits::allocate(alloc_base(), 1);
+            try
+            {
+                node_alloc_traits::construct(alloc_base(), &value_of(p), std::forward<Ts>(ts)...);
+            }
+            catch (...)
+            {
+                node_alloc_traits::deallocate(alloc_base(), p, 1);
+                throw;
+            }
+            return p;
+        }
+
+        void delete_node(node_t* p) noexcept
+        {
+            node_alloc_traits::destroy(alloc_base(), &value_of(p));
+            node_alloc_traits::deallocate(alloc_base(), p, 1);
+        }
+
+        void destroy_chain(node_t* p) noexcept
+        {
+            while (p)
+            {
+                node_t* next = next_of(p);
+                delete_node(p);
+                p = next;
+            }
+        }
+
+        template<class F>
+        size_type consume_front(F& f)
+        {
+            size_type n = 0;
+            while (node_t* p = _front)
+            {
+                _front = next_of(p);
+                node_deleter d{this, p};
+                f(value_of(p));
+                ++n;
+            }
+            return n;
+        }
+
+        // Take the pushed nodes, oldest first.
+        node_t* take() noexcept
+        {
+            node_t* p = _back.exchange(nullptr, std::memory_order_acquire);
+            node_t* prev = nullptr;
+            while (p)
+            {
+                node_t* next = next_of(p);
+                set_next(p, prev);
+                prev = p;
+                p = next;
+            }
+            return prev;
+        }
+
+        // Keep the producers' word away from the consumer's.
+        alignas(mpsc_queue_detail::cache_line_size) std::atomic<node_t*> _back;
+        alignas(mpsc_queue_detail::cache_line_size) node_t* _front;
+    };
+}
+
+#endif
\ No newline at end of file
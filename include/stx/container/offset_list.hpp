@@ -8,22 +8,26 @@
 #define STX_CONTAINER_OFFSET_LIST_HPP_INCLUDED
 
 #include <memory>
+#include <cstdint>
 #include <functional>
 #include <type_traits>
 #include <initializer_list>
+#include <boost/config.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 #include <stx/type_traits/is_iterator.hpp>
+#include <stx/type_traits/enable_if_valid.hpp>
 
 namespace stx
 {
-    template<class T, class Allocator = std::allocator<T>>
+    template<class T, class Allocator = std::allocator<T>, bool CacheSize = false>
     class offset_list;
 }
 
 namespace stx { namespace offset_list_detail
 {
+    // The root is accessed as a node, which must be exempt from TBAA.
     template<std::size_t Len, std::size_t Align>
-    struct aligned_node
+    struct BOOST_MAY_ALIAS aligned_node
     {
         std::ptrdiff_t diff;
         std::aligned_storage_t<Len, Align> data;
@@ -35,12 +39,14 @@ namespace stx { namespace offset_list_detail
     template<class T>
     inline T* advance_in_bytes(T* p, std::ptrdiff_t n)
     {
-        return reinterpret_cast<T*>(reinterpret_cast<char*>(p)+n);
+        // Go through integers: the result usually points to another object,
+        // which the optimizer must not assume to be `*p`.
+        return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(p) + n);
     }
 
-    inline std::ptrdiff_t distance_in_bytes(void* from, void* to)
+    inline std::ptrdiff_t distance_in_bytes(void const* from, void const* to)
     {
-        return static_cast<char*>(to)-static_cast<char*>(from);
+        return reinterpret_cast<std::uintptr_t>(to) - reinterpret_cast<std::uintptr_t>(from);
     }
 
     template<class T>
@@ -49,14 +55,16 @@ namespace stx { namespace offset_list_detail
     {
         iterator() : here() {}
 
-        iterator(iterator<std::remove_const_t<T>> const& other)
-        : prev(other.prev), here(other.here)
+        // A template, so that it does not suppress the implicit copy.
+        template<class U, std::enable_if_t<std::is_same<U const, T>::value, bool> = true>
+        iterator(iterator<U> const& other)
+          : prev(other.prev), here(other.here)
         {}
 
     private:
 
-        template<class U, class A>
-        friend class offset_list;
+        template<class U, class A, bool S>
+        friend class stx::offset_list;
         friend class iterator<T const>;
         friend class boost::iterator_core_access;
 
@@ -100,19 +108,101 @@ namespace stx { namespace offset_list_detail
         std::ptrdiff_t _tail;
     };
 
+    /// Keeps the element count when enabled, otherwise has no state.
+    template<bool Enable>
+    struct size_cache
+    {
+        std::size_t count() const noexcept
+        {
+            return 0;
+        }
+
+        void set_count(std::size_t) noexcept {}
+        void add_count(std::size_t) noexcept {}
+        void sub_count(std::size_t) noexcept {}
+
+        template<class It>
+        std::size_t size_of(It first, It last) const noexcept
+        {
+            return std::distance(first, last);
+        }
+
+        template<class It>
+        static std::size_t count_of(It, It) noexcept
+        {
+            return 0;
+        }
+    };
+
+    template<>
+    struct size_cache<true>
+    {
+        size_cache() noexcept : _size() {}
+
+        std::size_t count() const noexcept
+        {
+            return _size;
+        }
+
+        void set_count(std::size_t n) noexcept
+        {
+            _size = n;
+        }
+
+        void add_count(std::size_t n) noexcept
+        {
+            _size += n;
+        }
+
+        void sub_count(std::size_t n) noexcept
+        {
+            _size -= n;
+        }
+
+        template<class It>
+        std::size_t size_of(It, It) const noexcept
+        {
+            return _size;
+        }
+
+        template<class It>
+        static std::size_t count_of(It first, It last) noexcept
+        {
+            return std::distance(first, last);
+        }
+
+    private:
+
+        std::size_t _size;
+    };
+
     template<class Allocator, class T>
     using node_alloc = typename std::allocator_traits<Allocator>::
         template rebind_alloc<node<T>>;
+
+    /// Whether the memory from `allocate(n)` may be deallocated in parts,
+    /// as declared by `Allocator::divisible_allocation`.
+    template<class Allocator, class Enable = void>
+    struct is_divisible_allocator : std::false_type {};
+
+    template<class Allocator>
+    struct is_divisible_allocator<Allocator, enable_if_valid_t<typename Allocator::divisible_allocation>>
+      : Allocator::divisible_allocation
+    {};
 }}
 
 namespace stx
 {
-    template<class T, class Allocator>
+    /// With `CacheSize` the element count is maintained, making `size()`
+    /// O(1) at the cost of a word in the list and linear range `splice`.
+    template<class T, class Allocator, bool CacheSize>
     class alignas(offset_list_detail::node<T>) offset_list
       : offset_list_detail::root
+      , offset_list_detail::size_cache<CacheSize>
       , offset_list_detail::node_alloc<Allocator, T>
     {
         using node_t = offset_list_detail::node<T>;
+        using size_cache = offset_list_detail::size_cache<CacheSize>;
         using node_alloc = offset_list_detail::node_alloc<Allocator, T>;
         using node_alloc_traits = std::allocator_traits<node_alloc>;
         using alloc_traits = std::allocator_traits<Allocator>;
@@ -137,29 +227,26 @@ namespace stx
         {}
 
         explicit offset_list(Allocator const& alloc) noexcept
-          : root(), node_alloc(alloc)
+          : root(), size_cache(), node_alloc(alloc)
         {}
 
         offset_list(size_type count, T const& val, Allocator const& alloc = Allocator())
           : offset_list(alloc)
         {
-            while (count--)
-                emplace_back(val);
+            insert_n(end(), count, val);
         }
 
         offset_list(size_type count, Allocator const& alloc = Allocator())
           : offset_list(alloc)
         {
-            while (count--)
-                emplace_back();
+            insert_n(end(), count);
         }
 
         template<class InputIt, std::enable_if_t<is_input_iterator<InputIt>::value, bool> = true>
         offset_list(InputIt first, InputIt last, Allocator const& alloc = Allocator())
           : offset_list(alloc)
         {
-            for (; first != last; ++first)
-                emplace_back(*first);
+            insert(end(), first, last);
         }
 
         offset_list(offset_list const& other)
@@ -176,7 +263,7 @@ namespace stx
         {}
 
         offset_list(offset_list&& other, Allocator const& alloc) noexcept
-          : node_alloc(alloc)
+          : size_cache(), node_alloc(alloc)
         {
             if (other._head)
                 steal(other);
@@ -226,7 +313,7 @@ namespace stx
                     return *this;
                 }
             }
-            ~offset_list();
+            this->~offset_list();
             return *new(this) offset_list(std::move(other), other.alloc_base());
         }
 
@@ -251,11 +338,7 @@ namespace stx
                     return;
                 }
             }
-            if (count)
-            {
-                offset_list tmp(count, val, alloc_base());
-                splice_impl(e, tmp, tmp.begin(), tmp.end());
-            }
+            insert_n(e, count, val);
         }
 
         /// \exception-safety basic
@@ -273,11 +356,7 @@ namespace stx
                     return;
                 }
             }
-            if (first != last)
-            {
-                offset_list tmp(first, last, alloc_base());
-                splice_impl(e, tmp, tmp.begin(), tmp.end());
-            }
+            insert(e, first, last);
         }
 
         /// \exception-safety basic
@@ -378,7 +457,7 @@ namespace stx
 
         size_type size() const noexcept
         {
-            return std::distance(begin(), end());
+            return this->size_of(begin(), end());
         }
 
         size_type max_size() const noexcept
@@ -391,6 +470,7 @@ namespace stx
             destroy(begin(), end());
             _head = 0;
             _tail = 0;
+            this->set_count(0);
         }
 
         /// \exception-safety strong
@@ -408,14 +488,18 @@ namespace stx
         /// \exception-safety strong
         iterator insert(const_iterator pos, size_type count, T const& val)
         {
-            return count? insert_multi(pos, count, val) : pos;
+            return insert_n(pos, count, val);
         }
 
         /// \exception-safety strong
         template<class InputIt, std::enable_if_t<is_input_iterator<InputIt>::value, bool> = true>
         iterator insert(const_iterator pos, InputIt first, InputIt last)
         {
-            return first != last? insert_multi(pos, first, last) : pos;
+            chain_builder chain(this, pos);
+            reserve_for(chain, first, last, is_forward_iterator<InputIt>());
+            for (; first != last; ++first)
+                chain.emplace(*first);
+            return chain.commit();
         }
 
         /// \exception-safety strong
@@ -424,6 +508,29 @@ namespace stx
             return insert(pos, ilist.begin(), ilist.end());
         }
 
+        /// \exception-safety strong
+        template<class Range>
+        iterator insert_range(const_iterator pos, Range&& range)
+        {
+            using std::begin;
+            using std::end;
+            return insert(pos, begin(range), end(range));
+        }
+
+        /// \exception-safety strong
+        template<class Range>
+        void append_range(Range&& range)
+        {
+            (void)insert_range(end(), range);
+        }
+
+        /// \exception-safety strong
+        template<class Range>
+        void prepend_range(Range&& range)
+        {
+            (void)insert_range(begin(), range);
+        }
+
         /// \exception-safety strong
         template<class... Args>
         iterator emplace(const_iterator pos, Args&&... args)
@@ -435,6 +542,7 @@ namespace stx
                 pos.here->diff += distance_in_bytes(p, pos.prev);
             else
                 _tail = distance_in_bytes(this, p);
+            this->add_count(1);
             return iterator(pos.prev, p);
         }
 
@@ -442,20 +550,21 @@ namespace stx
         {
             using namespace offset_list_detail;
             std::ptrdiff_t diff = pos.here->diff;
-            delete_node(pos.here);
             node_t* next = advance_in_bytes(pos.prev, diff);
             pos.prev->diff += distance_in_bytes(pos.here, next);
             if (next != reinterpret_cast<node_t*>(this))
                 next->diff += distance_in_bytes(pos.prev, pos.here);
             else
                 _tail = -diff;
+            delete_node(pos.here);
+            this->sub_count(1);
             return iterator(pos.prev, next);
         }
 
         iterator erase(const_iterator first, const_iterator last) noexcept
         {
             using namespace offset_list_detail;
-            destroy(first, last);
+            this->sub_count(destroy(first, last));
             node_t* next = last.here;
             first.prev->diff += distance_in_bytes(first.here, next);
             if (next != reinterpret_cast<node_t*>(this))
@@ -486,6 +595,7 @@ namespace stx
             std::ptrdiff_t next_tail = distance_in_bytes(this, p);
             node(_tail)->diff += next_tail;
             _tail = next_tail;
+            this->add_count(1);
         }
 
         void pop_back() noexcept
@@ -493,9 +603,10 @@ namespace stx
             using namespace offset_list_detail;
             node_t* last = node(_tail);
             std::ptrdiff_t next_tail = -last->diff;
-            delete_node(last);
             node(next_tail)->diff += distance_in_bytes(last, this);
             _tail = next_tail;
+            delete_node(last);
+            this->sub_count(1);
         }
 
         /// \exception-safety strong
@@ -559,6 +670,9 @@ namespace stx
                     there->diff += offset;
                     _tail = distance_in_bytes(this, there);
                     other._tail = distance_in_bytes(&other, here);
+                    size_type n = this->count();
+                    this->set_count(other.count());
+                    other.set_count(n);
                 }
                 else
                     steal(other);
@@ -569,24 +683,27 @@ namespace stx
 
         void splice(const_iterator pos, offset_list& other)
         {
-            splice(pos, other, other.begin(), other.end());
+            if (!other.empty())
+                splice_impl(pos, other, other.begin(), other.end(), other.count());
         }
 
         void splice(const_iterator pos, offset_list&& other)
         {
-            splice(pos, other, other.begin(), other.end());
+            splice(pos, other);
         }
 
         void splice(const_iterator pos, offset_list& other, const_iterator it)
         {
             const_iterator next(it);
-            splice_impl(pos, other, it, ++next);
+            splice_impl(pos, other, it, ++next, 1);
         }
 
+        /// \complexity linear in the range size if `CacheSize` and `other`
+        /// is not `*this`, otherwise constant.
         void splice(const_iterator pos, offset_list& other, const_iterator first, const_iterator last)
         {
             if (first != last)
-                splice_impl(pos, other, first, last);
+                splice_impl(pos, other, first, last, &other != this? this->count_of(first, last) : 0);
         }
 
         void remove(T const& val)
@@ -637,7 +754,7 @@ namespace stx
             const_iterator i(begin()), e(end());
             if (i != e)
             {
-                prev = &i.here->data;
+                prev = &*i;
                 ++i;
                 while (i != e)
                 {
@@ -645,13 +762,109 @@ namespace stx
                         i = erase(i);
                     else
                     {
-                        prev = &i.here->data;
+                        prev = &*i;
                         ++i;
                     }
                 }
             }
         }
 
+        /// Merge the sorted `other` into this sorted list by relinking the
+        /// nodes. Equivalent elements of this list precede those of `other`.
+        /// The allocators must compare equal.
+        ///
+        /// \exception-safety basic
+        template<class Compare>
+        void merge(offset_list& other, Compare cmp)
+        {
+            if (&other == this || other.empty())
+                return;
+            this->add_count(other.count());
+            other.set_count(0);
+            node_t* left = unlink_forward();
+            node_t* right = other.unlink_forward();
+            other._head = 0;
+            other._tail = 0;
+            link_merged(left, right, cmp);
+        }
+
+        template<class Compare>
+        void merge(offset_list&& other, Compare cmp)
+        {
+            merge(other, cmp);
+        }
+
+        void merge(offset_list& other)
+        {
+            merge(other, std::less<>());
+        }
+
+        void merge(offset_list&& other)
+        {
+            merge(other, std::less<>());
+        }
+
+        /// Stable bottom-up merge sort that only relinks the nodes.
+        ///
+        /// \exception-safety basic
+        template<class Compare>
+        void sort(Compare cmp)
+        {
+            // bins[i] holds a sorted run of 2^i nodes, preceding the later ones.
+            node_t* bins[sizeof(size_type) * 8] = {};
+            std::size_t fill = 0;
+            iterator it(begin()), e(end());
+            node_t* carry = nullptr;
+            node_t* result = nullptr;
+            try
+            {
+                while (it != e)
+                {
+                    carry = it.here;
+                    ++it;
+                    set_next(carry, nullptr);
+                    std::size_t i = 0;
+                    for (; i != fill && bins[i]; ++i)
+                        merge_chains(bins[i], carry, cmp);
+                    bins[i] = carry;
+                    carry = nullptr;
+                    if (i == fill)
+                        ++fill;
+                }
+                for (std::size_t i = 0; i + 1 < fill; ++i)
+                {
+                    if (bins[i])
+                    {
+                        if (result)
+                            merge_chains(bins[i], result, cmp);
+                        else
+                            std::swap(bins[i], result);
+                    }
+                }
+            }
+            catch (...)
+            {
+                result = concat_chains(result, carry);
+                result = concat_chains(result, unlink_forward(it, e));
+                for (std::size_t i = 0; i != fill; ++i)
+                    result = concat_chains(result, bins[i]);
+                relink(result);
+                throw;
+            }
+            if (!fill)
+                return;
+            // The last merge restores the links on the way.
+            if (result)
+                link_merged(bins[fill - 1], result, cmp);
+            else
+                relink(bins[fill - 1]);
+        }
+
+        void sort()
+        {
+            sort(std::less<>());
+        }
+
     private:
 
         node_t* node(std::ptrdiff_t offset)
@@ -671,6 +884,11 @@ namespace stx
             return static_cast<node_alloc&>(*this);
         }
 
+        node_alloc const& alloc_base() const
+        {
+            return static_cast<node_alloc const&>(*this);
+        }
+
         template<class... Ts>
         node_t* new_node(std::ptrdiff_t diff, Ts&&... ts)
         {
@@ -699,6 +917,187 @@ namespace stx
             node_alloc_traits::deallocate(alloc_base(), p, 1);
         }
 
+        static T& value_of(node_t* p) noexcept
+        {
+            return *reinterpret_cast<T*>(&p->data);
+        }
+
+        // In a forward chain, `diff` is the offset to the next node, or 0 at
+        // the end of the chain.
+        static node_t* next_of(node_t* p) noexcept
+        {
+            using namespace offset_list_detail;
+            return p->diff? advance_in_bytes(p, p->diff) : nullptr;
+        }
+
+        static void set_next(node_t* p, node_t* next) noexcept
+        {
+            using namespace offset_list_detail;
+            p->diff = next? distance_in_bytes(p, next) : 0;
+        }
+
+        // Turn the nodes into a forward chain, leaving the root dangling.
+        node_t* unlink_forward() noexcept
+        {
+            return unlink_forward(begin(), end());
+        }
+
+        static node_t* unlink_forward(iterator i, iterator e) noexcept
+        {
+            if (i == e)
+                return nullptr;
+            node_t* head = i.here;
+            do
+            {
+                node_t* here = i.here;
+                ++i;
+                set_next(here, i != e? i.here : nullptr);
+            } while (i != e);
+            return head;
+        }
+
+        // Rebuilds the list from nodes appended in order.
+        class relinker
+        {
+            node_t* _prev;
+            node_t* _tail;
+
+        public:
+
+            explicit relinker(offset_list* list) noexcept
+              : _prev(reinterpret_cast<node_t*>(list)), _tail(_prev)
+            {}
+
+            void append(node_t* p) noexcept
+            {
+                using namespace offset_list_detail;
+                _tail->diff = distance_in_bytes(_prev, p);
+                _prev = _tail;
+                _tail = p;
+            }
+
+            void append_chain(node_t* p) noexcept
+            {
+                while (p)
+                {
+                    node_t* next = next_of(p);
+                    append(p);
+                    p = next;
+                }
+            }
+
+            void finish(offset_list* list) noexcept
+            {
+                using namespace offset_list_detail;
+                append(reinterpret_cast<node_t*>(list));
+                list->_tail = distance_in_bytes(list, _prev);
+            }
+        };
+
+        // Make the forward chain `head` the content of the list.
+        void relink(node_t* head) noexcept
+        {
+            relinker r(this);
+            r.append_chain(head);
+            r.finish(this);
+        }
+
+        // Make the merge of the forward chains `a` and `b` the content
+        // of the list. Even if `cmp` throws, all the nodes are kept.
+        template<class Compare>
+        void link_merged(node_t* a, node_t* b, Compare& cmp)
+        {
+            relinker r(this);
+            try
+            {
+                while (a && b)
+                {
+                    node_t* p;
+                    if (cmp(value_of(b), value_of(a)))
+                    {
+                        p = b;
+                        b = next_of(b);
+                    }
+                    else
+                    {
+                        p = a;
+                        a = next_of(a);
+                    }
+                    r.append(p);
+                }
+            }
+            catch (...)
+            {
+                r.append_chain(a);
+                r.append_chain(b);
+                r.finish(this);
+                throw;
+            }
+            r.append_chain(a? a : b);
+            r.finish(this);
+        }
+
+        static node_t* concat_chains(node_t* first, node_t* second) noexcept
+        {
+            if (!first)
+                return second;
+            node_t* last = first;
+            while (node_t* next = next_of(last))
+                last = next;
+            set_next(last, second);
+            return first;
+        }
+
+        // Merge `left` into `right`, leaving `left` empty. Even if `cmp`
+        // throws, all the nodes end up in `right`.
+        template<class Compare>
+        static void merge_chains(node_t*& left, node_t*& right, Compare& cmp)
+        {
+            node_t* a = left;
+            node_t* b = right;
+            left = nullptr;
+            node_t* head = nullptr;
+            node_t* tail = nullptr;
+            try
+            {
+                while (a && b)
+                {
+                    node_t* p;
+                    if (cmp(value_of(b), value_of(a)))
+                    {
+                        p = b;
+                        b = next_of(b);
+                    }
+                    else
+                    {
+                        p = a;
+                        a = next_of(a);
+                    }
+                    if (tail)
+                        set_next(tail, p);
+                    else
+                        head = p;
+                    tail = p;
+                }
+            }
+            catch (...)
+            {
+                a = concat_chains(a, b);
+                if (tail)
+                    set_next(tail, a);
+                else
+                    head = a;
+                right = head;
+                throw;
+            }
+            node_t* rest = a? a : b;
+            if (tail)
+                set_next(tail, rest);
+            else
+                head = rest;
+            right = head;
+        }
+
         void steal(offset_list& other)
         {
             using namespace offset_list_detail;
@@ -711,22 +1110,34 @@ namespace stx
             _tail = distance_in_bytes(this, there);
             other._head = 0;
             other._tail = 0;
+            this->set_count(other.count());
+            other.set_count(0);
         }
 
-        void destroy(const_iterator first, const_iterator last)
+        size_type destroy(const_iterator first, const_iterator last)
         {
+            size_type n = 0;
             const_iterator pos(first);
             while (pos != last)
             {
                 node_t* here = pos.here;
                 ++pos;
                 delete_node(here);
+                ++n;
             }
+            return n;
         }
 
-        void splice_impl(const_iterator pos, offset_list& other, const_iterator first, const_iterator last)
+        void splice_impl(const_iterator pos, offset_list& other, const_iterator first, const_iterator last, size_type n)
         {
             using namespace offset_list_detail;
+            if (pos.here == first.here || pos.here == last.here)
+                return;
+            if (&other != this)
+            {
+                other.sub_count(n);
+                this->add_count(n);
+            }
             pos.prev->diff += distance_in_bytes(pos.here, first.here);
             first.prev->diff += distance_in_bytes(first.here, last.here);
             first.here->diff += distance_in_bytes(pos.prev, first.prev);
@@ -741,18 +1152,131 @@ namespace stx
                 _tail = distance_in_bytes(this, last.prev);
         }
 
+        // Builds nodes before `pos`, linked only among themselves until
+        // `commit()`, so that they can be dropped if construction fails.
+        class chain_builder
+        {
+            offset_list* _list;
+            node_t* _prev;
+            node_t* _here;
+            node_t* _first;
+            node_t* _last;
+            node_t* _spare;
+            size_type _spares;
+            size_type _count;
+
+        public:
+
+            chain_builder(offset_list* list, const_iterator pos) noexcept
+              : _list(list), _prev(pos.prev), _here(pos.here), _first(), _last(pos.prev)
+              , _spare(), _spares(), _count()
+            {}
+
+            chain_builder(chain_builder const&) = delete;
+            chain_builder& operator=(chain_builder const&) = delete;
+
+            ~chain_builder()
+            {
+                using namespace offset_list_detail;
+                node_t* prev = _prev;
+                node_t* here = _first;
+                for (; _count; --_count)
+                {
+                    node_t* next = advance_in_bytes(prev, here->diff);
+                    _list->delete_node(here);
+                    prev = here;
+                    here = next;
+                }
+                if (_spares)
+                    node_alloc_traits::deallocate(_list->alloc_base(), _spare, _spares);
+            }
+
+            /// Allocate the nodes for `n` more elements at once, if the
+            /// allocator allows them to be deallocated one by one.
+            void reserve(size_type n)
+            {
+                if (!offset_list_detail::is_divisible_allocator<node_alloc>::value || n < 2 || _spares)
+                    return;
+                try
+                {
+                    _spare = node_alloc_traits::allocate(_list->alloc_base(), n);
+                    _spares = n;
+                }
+                catch (std::bad_alloc&)
+                {
+                    // A fragmented arena may still have single blocks.
+                }
+            }
+
+            template<class... Ts>
+            void emplace(Ts&&... ts)
+            {
+                using namespace offset_list_detail;
+                node_t* p;
+                if (_spares)
+                {
+                    p = _spare;
+                    node_alloc_traits::construct(_list->alloc_base(), &value_of(p), std::forward<Ts>(ts)...);
+                    ++_spare;
+                    --_spares;
+                    p->diff = distance_in_bytes(_last, _here);
+                }
+                else
+                    p = _list->new_node(distance_in_bytes(_last, _here), std::forward<Ts>(ts)...);
+                if (_first)
+                    _last->diff += distance_in_bytes(_here, p);
+                else
+                    _first = p;
+                _last = p;
+                ++_count;
+            }
+
+            /// Link the nodes into the list, returning the first of them.
+            iterator commit() noexcept
+            {
+                using namespace offset_list_detail;
+                if (_spares)
+                {
+                    node_alloc_traits::deallocate(_list->alloc_base(), _spare, _spares);
+                    _spares = 0;
+                }
+                if (!_count)
+                    return iterator(_prev, _here);
+                _prev->diff += distance_in_bytes(_here, _first);
+                if (_here != reinterpret_cast<node_t*>(_list))
+                    _here->diff += distance_in_bytes(_last, _prev);
+                else
+                    _list->_tail = distance_in_bytes(_list, _last);
+                _list->add_count(_count);
+                _count = 0;
+                return iterator(_prev, _first);
+            }
+        };
+
         template<class... Ts>
-        iterator insert_multi(const_iterator& pos, Ts const&... ts)
+        iterator insert_n(const_iterator pos, size_type count, Ts const&... ts)
         {
-            offset_list tmp(ts..., alloc_base());
-            iterator it(tmp.begin());
-            splice_impl(pos, tmp, it, tmp.end());
-            return iterator(pos.prev, it.here);
+            chain_builder chain(this, pos);
+            chain.reserve(count);
+            for (; count; --count)
+                chain.emplace(ts...);
+            return chain.commit();
         }
 
+        template<class ForwardIt>
+        static void reserve_for(chain_builder& chain, ForwardIt first, ForwardIt last, std::true_type)
+        {
+            chain.reserve(std::distance(first, last));
+        }
+
+        template<class InputIt>
+        static void reserve_for(chain_builder&, InputIt, InputIt, std::false_type) {}
+
         template<class... Ts>
         void resize_impl(size_type count, Ts const&... ts)
         {
+            if (CacheSize)
+                return resize_counted(count, ts...);
             iterator i(begin()), e(end());
             for ( ; i != e; ++i, --count)
             {
@@ -762,52 +1286,62 @@ namespace stx
                     return;
                 }
             }
-            if (count)
+            insert_n(e, count, ts...);
+        }
+
+        template<class... Ts>
+        void resize_counted(size_type count, Ts const&... ts)
+        {
+            size_type n = this->count();
+            if (count < n)
             {
-                offset_list tmp(count, ts..., alloc_base());
-                splice_impl(e, tmp, tmp.begin(), tmp.end());
+                // Walk from the nearer end.
+                iterator i = count < n - count? std::next(begin(), count) : std::prev(end(), n - count);
+                erase(i, end());
             }
+            else if (count > n)
+                insert_n(end(), count - n, ts...);
         }
     };
 
-    template<class T, class Alloc>
-    inline bool operator==(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline bool operator==(offset_list<T, Alloc, S> const& lhs, offset_list<T, Alloc, S> const& rhs)
     {
         return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template<class T, class Alloc>
-    inline bool operator!=(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline bool operator!=(offset_list<T, Alloc, S> const& lhs, offset_list<T, Alloc, S> const& rhs)
     {
         return !(rhs == lhs);
     }
 
-    template<class T, class Alloc>
-    inline bool operator<(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline bool operator<(offset_list<T, Alloc, S> const& lhs, offset_list<T, Alloc, S> const& rhs)
     {
         return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template<class T, class Alloc>
-    inline bool operator<=(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline bool operator<=(offset_list<T, Alloc, S> const& lhs, offset_list<T, Alloc, S> const& rhs)
     {
         return !(rhs < lhs);
     }
 
-    template<class T, class Alloc>
-    inline bool operator>(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline bool operator>(offset_list<T, Alloc, S> const& lhs, offset_list<T, Alloc, S> const& rhs)
     {
         return rhs < lhs;
     }
 
-    template<class T, class Alloc>
-    inline bool operator>=(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline bool operator>=(offset_list<T, Alloc, S> const& lhs, offset_list<T, Alloc, S> const& rhs)
     {
         return !(lhs < rhs);
     }
 
-    template<class T, class Alloc>
-    inline void swap(offset_list<T, Alloc> const& lhs, offset_list<T, Alloc> const& rhs)
+    template<class T, class Alloc, bool S>
+    inline void swap(offset_list<T, Alloc, S>& lhs, offset_list<T, Alloc, S>& rhs)
     {
         lhs.swap(rhs);
     }
@@ -0,0 +1,95 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_CONTAINER_RELOCATABLE_LIST_HPP_INCLUDED
+#define STX_CONTAINER_RELOCATABLE_LIST_HPP_INCLUDED
+
+#include <new>
+#include <cstring>
+#include <stx/container/offset_list.hpp>
+#include <stx/memory/relocatable_arena.hpp>
+
+namespace stx
+{
+    /// An `offset_list` that lives at the front of a buffer together with all
+    /// its nodes. The first `size_in_bytes()` bytes of the buffer can be
+    /// copied, `realloc`ed or shipped elsewhere and used there as is, provided
+    /// that `T` itself is relocatable and the new buffer is equally aligned.
+    ///
+    /// Operations that run out of space throw `std::bad_alloc`; enlarge the
+    /// buffer (e.g. with `realloc`) and call `set_capacity()` to make room.
+    template<class T>
+    class relocatable_list
+    {
+        using node_t = offset_list_detail::node<T>;
+
+    public:
+
+        using list_type = offset_list<T, relocatable_allocator<T>>;
+
+        /// Construct at the beginning of a buffer of `capacity` bytes.
+        explicit relocatable_list(std::size_t capacity) noexcept
+          : _arena(capacity, sizeof(relocatable_list), sizeof(node_t), alignof(node_t))
+          , _list(relocatable_allocator<T>(_arena))
+        {}
+
+        relocatable_list(relocatable_list const&) = delete;
+        relocatable_list& operator=(relocatable_list const&) = delete;
+
+        static relocatable_list* create(void* buffer, std::size_t capacity) noexcept
+        {
+            return new(buffer) relocatable_list(capacity);
+        }
+
+        /// Access a list that has been copied into `buffer`.
+        static relocatable_list* from(void* buffer) noexcept
+        {
+            return static_cast<relocatable_list*>(buffer);
+        }
+
+        /// Copy the whole list into `buffer` of `capacity` bytes, which must
+        /// not be less than `size_in_bytes()`.
+        relocatable_list* relocate(void* buffer, std::size_t capacity) const noexcept
+        {
+            std::memcpy(buffer, this, size_in_bytes());
+            relocatable_list* p = from(buffer);
+            p->set_capacity(capacity);
+            return p;
+        }
+
+        list_type& list() noexcept
+        {
+            return _list;
+        }
+
+        list_type const& list() const noexcept
+        {
+            return _list;
+        }
+
+        std::size_t size_in_bytes() const noexcept
+        {
+            return _arena.size();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return _arena.capacity();
+        }
+
+        void set_capacity(std::size_t capacity) noexcept
+        {
+            _arena.set_capacity(capacity);
+        }
+
+    private:
+
+        relocatable_arena _arena;
+        list_type _list;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,194 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_CONTAINER_STATIC_BTREE_SET_HPP_INCLUDED
+#define STX_CONTAINER_STATIC_BTREE_SET_HPP_INCLUDED
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+#include <stx/algorithm/binary_search.hpp>
+
+namespace stx
+{
+    /// An immutable sorted set laid out as an implicit B+ tree (S+ tree):
+    /// each node holds `node_size` keys in 128 bytes, or 8 keys for larger
+    /// types, and has `node_size + 1` children found by arithmetic, so a
+    /// search takes one or two cache misses per level, with a fanout of 33
+    /// for 32-bit keys. Each node is searched linearly, with SIMD for
+    /// arithmetic keys compared with `std::less`.
+    ///
+    /// The leaves are the sorted keys themselves, so iterators are plain
+    /// pointers. Built once from a sorted range. `T` must be
+    /// default-constructible.
+    template<class T, class Compare = std::less<T>, class Allocator = std::allocator<T>>
+    class static_btree_set
+    {
+    public:
+
+        static constexpr std::size_t node_size = binary_search_detail::window<T>();
+
+    private:
+
+        static constexpr std::size_t fanout = node_size + 1;
+        static constexpr unsigned max_height = 32;
+
+        using is_fast = binary_search_detail::is_fast<T const*, T, Compare>;
+
+        // The leaf layer comes first, padded to whole nodes, followed by the
+        // layers above it. A key of an inner node is the least key of the
+        // subtree to its right; the padding repeats the greatest key.
+        std::vector<T, Allocator> _keys;
+        std::size_t _size;
+        unsigned _height;
+        std::size_t _layers[max_height];
+        Compare _comp;
+
+    public:
+
+        using key_type = T;
+        using value_type = T;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T const&;
+        using const_reference = T const&;
+        using const_iterator = T const*;
+        using iterator = const_iterator;
+
+        static_btree_set() : _size(0), _height(0), _layers() {}
+
+        /// [first, last) must be sorted by `comp`.
+        template<class ForwardIt>
+        static_btree_set(ForwardIt first, ForwardIt last, Compare const& comp = Compare(), Allocator const& alloc = Allocator())
+          : _keys(alloc), _size(std::size_t(std::distance(first, last))), _height(0), _layers(), _comp(comp)
+        {
+            build(first, last);
+        }
+
+        static_btree_set(std::initializer_list<T> list, Compare const& comp = Compare(), Allocator const& alloc = Allocator())
+          : static_btree_set(list.begin(), list.end(), comp, alloc)
+        {}
+
+        size_type size() const noexcept
+        {
+            return _size;
+        }
+
+        bool empty() const noexcept
+        {
+            return !_size;
+        }
+
+        /// The keys in sorted order.
+        T const* data() const noexcept
+        {
+            return _keys.data();
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + _size;
+        }
+
+        key_compare key_comp() const
+        {
+            return _comp;
+        }
+
+        const_iterator lower_bound(T const& val) const
+        {
+            return data() + lower_bound_index(val);
+        }
+
+        const_iterator find(T const& val) const
+        {
+            std::size_t i = lower_bound_index(val);
+            return data() + (i != _size && !_comp(val, _keys[i])? i : _size);
+        }
+
+        bool contains(T const& val) const
+        {
+            return find(val) != end();
+        }
+
+    private:
+
+        template<class ForwardIt>
+        void build(ForwardIt first, ForwardIt last)
+        {
+            if (!_size)
+                return;
+            std::size_t nodes = (_size + node_size - 1) / node_size;
+            std::size_t total = 0;
+            for (;;)
+            {
+                _layers[_height++] = total;
+                total += nodes * node_size;
+                if (nodes == 1)
+                    break;
+                nodes = (nodes + fanout - 1) / fanout;
+            }
+            _keys.reserve(total);
+            _keys.assign(first, last);
+            _keys.resize(total, _keys.back());
+            // The number of keys under a child of a node on layer `h`.
+            std::size_t span = node_size;
+            for (unsigned h = 1; h != _height; ++h)
+            {
+                T* node = _keys.data() + _layers[h];
+                T* const end = _keys.data() + (h + 1 == _height? total : _layers[h + 1]);
+                for (std::size_t child = 1; node != end; ++child)
+                {
+                    std::size_t i = child * span;
+                    *node++ = _keys[i < _size? i : _size - 1];
+                    if (child % fanout == node_size)
+                        ++child;
+                }
+                span *= fanout;
+            }
+        }
+
+        // The number of keys in the node at `p` that are less than `val`.
+        std::size_t count_less(T const* p, T const& val, std::true_type) const noexcept
+        {
+            return binary_search_detail::count_less(p, val, binary_search_detail::has_simd<T>());
+        }
+
+        std::size_t count_less(T const* p, T const& val, std::false_type) const
+        {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i != node_size; ++i)
+                n += _comp(p[i], val);
+            return n;
+        }
+
+        std::size_t lower_bound_index(T const& val) const
+        {
+            // Past the greatest key the padding would not stop the descent.
+            if (!_size || _comp(_keys[_size - 1], val))
+                return _size;
+            T const* keys = _keys.data();
+            std::size_t k = 0;
+            for (unsigned h = _height - 1; h; --h)
+                k = k * fanout + count_less(keys + _layers[h] + k * node_size, val, is_fast());
+            return k * node_size + count_less(keys + k * node_size, val, is_fast());
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,928 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_CONTAINER_UNROLLED_OFFSET_LIST_HPP_INCLUDED
+#define STX_CONTAINER_UNROLLED_OFFSET_LIST_HPP_INCLUDED
+
+#include <new>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+#include <boost/config.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <stx/type_traits/is_iterator.hpp>
+#include <stx/container/offset_list.hpp>
+
+namespace stx { namespace unrolled_offset_list_detail
+{
+    constexpr std::size_t cache_line_size = 64;
+
+    /// Fill about two cache lines, but keep at least 4 elements per node.
+    template<class T>
+    constexpr std::size_t default_capacity()
+    {
+        return std::max<std::size_t>(
+            (2 * cache_line_size - 2 * sizeof(std::ptrdiff_t)) / sizeof(T), 4);
+    }
+}}
+
+namespace stx
+{
+    template<class T, class Allocator = std::allocator<T>,
+        std::size_t N = unrolled_offset_list_detail::default_capacity<T>()>
+    class unrolled_offset_list;
+}
+
+namespace stx { namespace unrolled_offset_list_detail
+{
+    // Like offset_list_detail::aligned_node, `diff` comes first so that the
+    // root can be accessed as a node.
+    template<std::size_t Len, std::size_t Align, std::size_t N>
+    struct BOOST_MAY_ALIAS aligned_node
+    {
+        std::ptrdiff_t diff;
+        std::size_t count;
+        std::aligned_storage_t<Len, Align> data[N];
+    };
+
+    template<class T, std::size_t N>
+    using node = aligned_node<sizeof(T), alignof(T), N>;
+
+    template<class T, std::size_t N>
+    struct iterator
+      : boost::iterator_facade<iterator<T, N>, T, std::bidirectional_iterator_tag>
+    {
+        iterator() : here(), pos() {}
+
+        // A template, so that it does not suppress the implicit copy.
+        template<class U, std::enable_if_t<std::is_same<U const, T>::value, bool> = true>
+        iterator(iterator<U, N> const& other)
+          : prev(other.prev), here(other.here), pos(other.pos)
+        {}
+
+    private:
+
+        template<class U, class A, std::size_t M>
+        friend class stx::unrolled_offset_list;
+        friend class iterator<T const, N>;
+        friend class boost::iterator_core_access;
+
+        using node_t = node<T, N>;
+
+        iterator(node_t* prev, node_t* here, std::size_t pos)
+          : prev(prev), here(here), pos(pos)
+        {}
+
+        bool equal(iterator const& other) const
+        {
+            return here == other.here && pos == other.pos;
+        }
+
+        T& dereference() const
+        {
+            return *reinterpret_cast<T*>(&here->data[pos]);
+        }
+
+        void increment()
+        {
+            using namespace offset_list_detail;
+            if (++pos == here->count)
+            {
+                node_t* next = advance_in_bytes(prev, here->diff);
+                prev = here;
+                here = next;
+                pos = 0;
+            }
+        }
+
+        void decrement()
+        {
+            using namespace offset_list_detail;
+            if (pos)
+                --pos;
+            else
+            {
+                node_t* prior = advance_in_bytes(here, -prev->diff);
+                here = prev;
+                prev = prior;
+                pos = here->count - 1;
+            }
+        }
+
+        node_t* prev;
+        node_t* here;
+        std::size_t pos;
+    };
+
+    template<class Allocator, class T, std::size_t N>
+    using node_alloc = typename std::allocator_traits<Allocator>::
+        template rebind_alloc<node<T, N>>;
+}}
+
+namespace stx
+{
+    /// An unrolled variant of `offset_list`: each node holds up to `N`
+    /// elements, so small elements are stored densely. A node left less
+    /// than half full by erasure is merged with a neighbor or refilled from
+    /// the next one. Iterators and references are invalidated by insertion
+    /// in their node and by erasure in their node or a neighboring one.
+    /// Whole-list `splice` is constant time when `pos` is at a node boundary.
+    /// `T` must be nothrow move constructible.
+    template<class T, class Allocator, std::size_t N>
+    class alignas(unrolled_offset_list_detail::node<T, N>) unrolled_offset_list
+      : offset_list_detail::root
+      , unrolled_offset_list_detail::node_alloc<Allocator, T, N>
+    {
+        static_assert(N > 1, "a node must hold more than one element");
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+            "unrolled_offset_list requires nothrow move constructible elements");
+
+        using node_t = unrolled_offset_list_detail::node<T, N>;
+        using node_alloc = unrolled_offset_list_detail::node_alloc<Allocator, T, N>;
+        using node_alloc_traits = std::allocator_traits<node_alloc>;
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+    public:
+
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using pointer = typename std::allocator_traits<Allocator>::pointer;
+        using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+        using iterator = unrolled_offset_list_detail::iterator<T, N>;
+        using const_iterator = unrolled_offset_list_detail::iterator<T const, N>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type node_capacity = N;
+
+        unrolled_offset_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+          : unrolled_offset_list(Allocator())
+        {}
+
+        explicit unrolled_offset_list(Allocator const& alloc) noexcept
+          : root(), node_alloc(alloc)
+        {}
+
+        unrolled_offset_list(size_type count, T const& val, Allocator const& alloc = Allocator())
+          : unrolled_offset_list(alloc)
+        {
+            try
+            {
+                while (count--)
+                    emplace_back(val);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        unrolled_offset_list(size_type count, Allocator const& alloc = Allocator())
+          : unrolled_offset_list(alloc)
+        {
+            try
+            {
+                while (count--)
+                    emplace_back();
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        template<class InputIt, std::enable_if_t<is_input_iterator<InputIt>::value, bool> = true>
+        unrolled_offset_list(InputIt first, InputIt last, Allocator const& alloc = Allocator())
+          : unrolled_offset_list(alloc)
+        {
+            try
+            {
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        unrolled_offset_list(unrolled_offset_list const& other)
+          : unrolled_offset_list(other, std::allocator_traits<Allocator>::
+                select_on_container_copy_construction(other.get_allocator()))
+        {}
+
+        unrolled_offset_list(unrolled_offset_list const& other, Allocator const& alloc)
+          : unrolled_offset_list(other.begin(), other.end(), alloc)
+        {}
+
+        unrolled_offset_list(unrolled_offset_list&& other) noexcept
+          : unrolled_offset_list(std::move(other), node_alloc(std::move(other.alloc_base())))
+        {}
+
+        unrolled_offset_list(unrolled_offset_list&& other, Allocator const& alloc) noexcept
+          : node_alloc(alloc)
+        {
+            if (other._head)
+                steal(other);
+            else
+            {
+                _head = 0;
+                _tail = 0;
+            }
+        }
+
+        unrolled_offset_list(std::initializer_list<T> init, Allocator const& alloc = Allocator())
+          : unrolled_offset_list(init.begin(), init.end(), alloc)
+        {}
+
+        ~unrolled_offset_list()
+        {
+            clear();
+        }
+
+        /// \exception-safety basic
+        unrolled_offset_list& operator=(unrolled_offset_list const& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                if (alloc_traits::propagate_on_container_copy_assignment::value)
+                    alloc_base() = other.alloc_base();
+                for (T const& val : other)
+                    emplace_back(val);
+            }
+            return *this;
+        }
+
+        unrolled_offset_list& operator=(unrolled_offset_list&& other) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value)
+        {
+            if (!alloc_traits::propagate_on_container_move_assignment::value)
+            {
+                if (alloc_base() != other.alloc_base())
+                {
+                    clear();
+                    for (T& val : other)
+                        emplace_back(std::move(val));
+                    return *this;
+                }
+            }
+            this->~unrolled_offset_list();
+            return *new(this) unrolled_offset_list(std::move(other), other.alloc_base());
+        }
+
+        /// \exception-safety basic
+        unrolled_offset_list& operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            for (T const& val : ilist)
+                emplace_back(val);
+            return *this;
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return static_cast<allocator_type const&>(*this);
+        }
+
+        reference front() noexcept
+        {
+            return *begin();
+        }
+
+        const_reference front() const noexcept
+        {
+            return *begin();
+        }
+
+        reference back() noexcept
+        {
+            node_t* p = node(_tail);
+            return value_at(p, p->count - 1);
+        }
+
+        const_reference back() const noexcept
+        {
+            return const_cast<unrolled_offset_list*>(this)->back();
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(sentinel(), node(_head), 0);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_cast<unrolled_offset_list*>(this)->begin();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return const_cast<unrolled_offset_list*>(this)->begin();
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(node(_tail), sentinel(), 0);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_cast<unrolled_offset_list*>(this)->end();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return const_cast<unrolled_offset_list*>(this)->end();
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const noexcept
+        {
+            return !_head;
+        }
+
+        /// \complexity linear in the number of nodes.
+        size_type size() const noexcept
+        {
+            using namespace offset_list_detail;
+            auto self = const_cast<unrolled_offset_list*>(this);
+            size_type n = 0;
+            node_t* prev = self->sentinel();
+            node_t* here = self->node(_head);
+            while (here != self->sentinel())
+            {
+                n += here->count;
+                node_t* next = advance_in_bytes(prev, here->diff);
+                prev = here;
+                here = next;
+            }
+            return n;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return alloc_traits::max_size(get_allocator());
+        }
+
+        void clear() noexcept
+        {
+            using namespace offset_list_detail;
+            node_t* prev = sentinel();
+            node_t* here = node(_head);
+            while (here != sentinel())
+            {
+                node_t* next = advance_in_bytes(prev, here->diff);
+                destroy_values(here, 0, here->count);
+                prev = here;
+                node_alloc_traits::deallocate(alloc_base(), here, 1);
+                here = next;
+            }
+            _head = 0;
+            _tail = 0;
+        }
+
+        /// \exception-safety strong
+        iterator insert(const_iterator pos, T const& val)
+        {
+            return emplace(pos, val);
+        }
+
+        /// \exception-safety strong
+        iterator insert(const_iterator pos, T&& val)
+        {
+            return emplace(pos, std::move(val));
+        }
+
+        /// \exception-safety strong
+        iterator insert(const_iterator pos, size_type count, T const& val)
+        {
+            return count? insert_multi(pos, count, val) : iterator(pos.prev, pos.here, pos.pos);
+        }
+
+        /// \exception-safety strong
+        template<class InputIt, std::enable_if_t<is_input_iterator<InputIt>::value, bool> = true>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            return first != last? insert_multi(pos, first, last) : iterator(pos.prev, pos.here, pos.pos);
+        }
+
+        /// \exception-safety strong
+        iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+        {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        /// \exception-safety strong
+        template<class... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            node_t* prev = pos.prev;
+            node_t* here = pos.here;
+            size_type i = pos.pos;
+            if (!i && prev != sentinel() && prev->count != N)
+            {
+                // Append to the previous node instead.
+                node_t* prior = offset_list_detail::advance_in_bytes(here, -prev->diff);
+                construct_value(prev, prev->count, std::forward<Args>(args)...);
+                return iterator(prior, prev, prev->count++);
+            }
+            if (here == sentinel())
+            {
+                node_t* p = link_node(prev, here);
+                try
+                {
+                    construct_value(p, 0, std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    unlink_node(prev, p, here);
+                    throw;
+                }
+                p->count = 1;
+                return iterator(prev, p, 0);
+            }
+            if (here->count == N)
+            {
+                node_t* p = split_node(prev, here, N / 2);
+                if (i > N / 2)
+                {
+                    prev = here;
+                    here = p;
+                    i -= N / 2;
+                }
+            }
+            if (i == here->count)
+                construct_value(here, i, std::forward<Args>(args)...);
+            else
+            {
+                T tmp(std::forward<Args>(args)...);
+                shift_right(here, i);
+                construct_value(here, i, std::move(tmp));
+            }
+            ++here->count;
+            return iterator(prev, here, i);
+        }
+
+        iterator erase(const_iterator pos) noexcept
+        {
+            using namespace offset_list_detail;
+            node_t* prev = pos.prev;
+            node_t* here = pos.here;
+            size_type i = pos.pos;
+            destroy_values(here, i, i + 1);
+            shift_left(here, i);
+            --here->count;
+            if (here->count < N / 2)
+                return rebalance(prev, here, i);
+            if (i == here->count)
+                return iterator(here, advance_in_bytes(prev, here->diff), 0);
+            return iterator(prev, here, i);
+        }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            for (size_type n = std::distance(first, last); n; --n)
+                first = erase(first);
+            return iterator(first.prev, first.here, first.pos);
+        }
+
+        /// \exception-safety strong
+        void push_back(T const& val)
+        {
+            emplace_back(val);
+        }
+
+        /// \exception-safety strong
+        void push_back(T&& val)
+        {
+            emplace_back(std::move(val));
+        }
+
+        /// \exception-safety strong
+        template<class... Args>
+        void emplace_back(Args&&... args)
+        {
+            node_t* tail = node(_tail);
+            if (tail != sentinel() && tail->count != N)
+            {
+                construct_value(tail, tail->count, std::forward<Args>(args)...);
+                ++tail->count;
+            }
+            else
+                (void)emplace(end(), std::forward<Args>(args)...);
+        }
+
+        void pop_back() noexcept
+        {
+            node_t* tail = node(_tail);
+            if (tail->count == 1)
+                (void)erase(std::prev(end()));
+            else
+            {
+                --tail->count;
+                destroy_values(tail, tail->count, tail->count + 1);
+            }
+        }
+
+        /// \exception-safety strong
+        void push_front(T const& val)
+        {
+            emplace_front(val);
+        }
+
+        /// \exception-safety strong
+        void push_front(T&& val)
+        {
+            emplace_front(std::move(val));
+        }
+
+        /// \exception-safety strong
+        template<class... Args>
+        void emplace_front(Args&&... args)
+        {
+            (void)emplace(begin(), std::forward<Args>(args)...);
+        }
+
+        void pop_front() noexcept
+        {
+            (void)erase(begin());
+        }
+
+        /// \exception-safety basic
+        void resize(size_type count)
+        {
+            resize_impl(count);
+        }
+
+        /// \exception-safety basic
+        void resize(size_type count, T const& val)
+        {
+            resize_impl(count, val);
+        }
+
+        void swap(unrolled_offset_list& other) noexcept
+        {
+            using namespace offset_list_detail;
+            if (alloc_traits::propagate_on_container_swap::value)
+            {
+                using std::swap;
+                swap(alloc_base(), other.alloc_base());
+            }
+            if (other._head)
+            {
+                if (_head)
+                {
+                    std::ptrdiff_t offset = distance_in_bytes(&other, this);
+                    node_t* here = node(_head);
+                    node_t* there = other.node(other._head);
+                    here->diff += offset;
+                    there->diff -= offset;
+                    _head = distance_in_bytes(this, there);
+                    other._head = distance_in_bytes(&other, here);
+                    here = node(_tail);
+                    there = other.node(other._tail);
+                    here->diff -= offset;
+                    there->diff += offset;
+                    _tail = distance_in_bytes(this, there);
+                    other._tail = distance_in_bytes(&other, here);
+                }
+                else
+                    steal(other);
+            }
+            else if (_head)
+                other.steal(*this);
+        }
+
+        /// Move all the nodes of `other` before `pos`. If `pos` is in the
+        /// middle of a node, that node is split first.
+        void splice(const_iterator pos, unrolled_offset_list& other)
+        {
+            if (&other != this && other._head)
+                (void)splice_impl(pos, other);
+        }
+
+        void splice(const_iterator pos, unrolled_offset_list&& other)
+        {
+            splice(pos, other);
+        }
+
+        void remove(T const& val)
+        {
+            remove_if([&val](T const& ref)
+            {
+                return ref == val;
+            });
+        }
+
+        template<class UnaryPredicate>
+        void remove_if(UnaryPredicate pred)
+        {
+            const_iterator i(begin()), e(end());
+            while (i != e)
+            {
+                if (pred(*i))
+                    i = erase(i);
+                else
+                    ++i;
+            }
+        }
+
+    private:
+
+        node_t* sentinel() noexcept
+        {
+            return reinterpret_cast<node_t*>(this);
+        }
+
+        node_t* node(std::ptrdiff_t offset) noexcept
+        {
+            using namespace offset_list_detail;
+            return static_cast<node_t*>(advance_in_bytes<void>(this, offset));
+        }
+
+        node_alloc& alloc_base()
+        {
+            return static_cast<node_alloc&>(*this);
+        }
+
+        node_alloc const& alloc_base() const
+        {
+            return static_cast<node_alloc const&>(*this);
+        }
+
+        static T& value_at(node_t* p, size_type i) noexcept
+        {
+            return *reinterpret_cast<T*>(&p->data[i]);
+        }
+
+        template<class... Ts>
+        void construct_value(node_t* p, size_type i, Ts&&... ts)
+        {
+            node_alloc_traits::construct(alloc_base(), &value_at(p, i), std::forward<Ts>(ts)...);
+        }
+
+        void destroy_values(node_t* p, size_type first, size_type last) noexcept
+        {
+            for (; first != last; ++first)
+                node_alloc_traits::destroy(alloc_base(), &value_at(p, first));
+        }
+
+        // Open the slot `i` by moving the elements after it one place up.
+        void shift_right(node_t* p, size_type i) noexcept
+        {
+            for (size_type j = p->count; j != i; --j)
+            {
+                construct_value(p, j, std::move(value_at(p, j - 1)));
+                destroy_values(p, j - 1, j);
+            }
+        }
+
+        // Close the destroyed slot `i` by moving the elements after it down.
+        void shift_left(node_t* p, size_type i) noexcept
+        {
+            for (size_type j = i + 1; j != p->count; ++j)
+            {
+                construct_value(p, j - 1, std::move(value_at(p, j)));
+                destroy_values(p, j, j + 1);
+            }
+        }
+
+        // Move-construct [first, last) of `from` at `to` onwards in `p`,
+        // which may be `from` if `to` is not after `first`.
+        void move_values(node_t* from, size_type first, size_type last, node_t* p, size_type to) noexcept
+        {
+            for (; first != last; ++first, ++to)
+            {
+                construct_value(p, to, std::move(value_at(from, first)));
+                destroy_values(from, first, first + 1);
+            }
+        }
+
+        // Allocate an empty node between `prev` and `next`.
+        node_t* link_node(node_t* prev, node_t* next)
+        {
+            using namespace offset_list_detail;
+            node_t* p = node_alloc_traits::allocate(alloc_base(), 1);
+            p->count = 0;
+            p->diff = distance_in_bytes(prev, next);
+            prev->diff += distance_in_bytes(next, p);
+            if (next != sentinel())
+                next->diff += distance_in_bytes(p, prev);
+            else
+                _tail = distance_in_bytes(this, p);
+            return p;
+        }
+
+        // Deallocate the empty node `here` between `prev` and `next`.
+        void unlink_node(node_t* prev, node_t* here, node_t* next) noexcept
+        {
+            using namespace offset_list_detail;
+            prev->diff += distance_in_bytes(here, next);
+            if (next != sentinel())
+                next->diff += distance_in_bytes(prev, here);
+            else
+                _tail = distance_in_bytes(this, prev);
+            node_alloc_traits::deallocate(alloc_base(), here, 1);
+        }
+
+        // Move the elements of `here` from `i` on into a new node after it.
+        node_t* split_node(node_t* prev, node_t* here, size_type i)
+        {
+            using namespace offset_list_detail;
+            node_t* p = link_node(here, advance_in_bytes(prev, here->diff));
+            move_values(here, i, here->count, p, 0);
+            p->count = here->count - i;
+            here->count = i;
+            return p;
+        }
+
+        // Merge the less than half full `here` with the next node if they
+        // fit in one, or else take elements from the next node until half
+        // full. The tail node is merged into the previous one if they fit.
+        // Return the position of the element that was at `i` in `here`.
+        iterator rebalance(node_t* prev, node_t* here, size_type i) noexcept
+        {
+            using namespace offset_list_detail;
+            node_t* next = advance_in_bytes(prev, here->diff);
+            if (next != sentinel())
+            {
+                if (here->count + next->count <= N)
+                {
+                    move_values(next, 0, next->count, here, here->count);
+                    here->count += next->count;
+                    next->count = 0;
+                    unlink_node(here, next, advance_in_bytes(here, next->diff));
+                }
+                else
+                {
+                    size_type k = N / 2 - here->count;
+                    move_values(next, 0, k, here, here->count);
+                    move_values(next, k, next->count, next, 0);
+                    here->count += k;
+                    next->count -= k;
+                }
+                return iterator(prev, here, i);
+            }
+            if (prev != sentinel() && prev->count + here->count <= N)
+            {
+                node_t* prior = advance_in_bytes(here, -prev->diff);
+                size_type j = prev->count + i;
+                move_values(here, 0, here->count, prev, prev->count);
+                prev->count += here->count;
+                here->count = 0;
+                unlink_node(prev, here, next);
+                return j == prev->count? iterator(prev, next, 0) : iterator(prior, prev, j);
+            }
+            if (!here->count)
+            {
+                unlink_node(prev, here, next);
+                return iterator(prev, next, 0);
+            }
+            return i == here->count? iterator(here, next, 0) : iterator(prev, here, i);
+        }
+
+        void steal(unrolled_offset_list& other)
+        {
+            using namespace offset_list_detail;
+            std::ptrdiff_t offset = distance_in_bytes(&other, this);
+            node_t* there = other.node(other._head);
+            there->diff -= offset;
+            _head = distance_in_bytes(this, there);
+            there = other.node(other._tail);
+            there->diff += offset;
+            _tail = distance_in_bytes(this, there);
+            other._head = 0;
+            other._tail = 0;
+        }
+
+        // Link the nodes of the non-empty `other` before `pos` and return
+        // the first element spliced.
+        iterator splice_impl(const_iterator pos, unrolled_offset_list& other)
+        {
+            using namespace offset_list_detail;
+            node_t* prev = pos.prev;
+            node_t* here = pos.here;
+            if (pos.pos)
+            {
+                node_t* p = split_node(prev, here, pos.pos);
+                prev = here;
+                here = p;
+            }
+            node_t* first = other.node(other._head);
+            node_t* last = other.node(other._tail);
+            first->diff += distance_in_bytes(prev, other.sentinel());
+            last->diff += distance_in_bytes(other.sentinel(), here);
+            prev->diff += distance_in_bytes(here, first);
+            if (here != sentinel())
+                here->diff += distance_in_bytes(last, prev);
+            else
+                _tail = distance_in_bytes(this, last);
+            other._head = 0;
+            other._tail = 0;
+            return iterator(prev, first, 0);
+        }
+
+        template<class... Ts>
+        iterator insert_multi(const_iterator pos, Ts const&... ts)
+        {
+            unrolled_offset_list tmp(ts..., get_allocator());
+            return splice_impl(pos, tmp);
+        }
+
+        template<class... Ts>
+        void resize_impl(size_type count, Ts const&... ts)
+        {
+            size_type n = size();
+            for (; n > count; --n)
+                pop_back();
+            for (; n < count; ++n)
+                emplace_back(ts...);
+        }
+    };
+
+    template<class T, class Alloc, std::size_t N>
+    inline bool operator==(unrolled_offset_list<T, Alloc, N> const& lhs, unrolled_offset_list<T, Alloc, N> const& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template<class T, class Alloc, std::size_t N>
+    inline bool operator!=(unrolled_offset_list<T, Alloc, N> const& lhs, unrolled_offset_list<T, Alloc, N> const& rhs)
+    {
+        return !(rhs == lhs);
+    }
+
+    template<class T, class Alloc, std::size_t N>
+    inline bool operator<(unrolled_offset_list<T, Alloc, N> const& lhs, unrolled_offset_list<T, Alloc, N> const& rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template<class T, class Alloc, std::size_t N>
+    inline bool operator<=(unrolled_offset_list<T, Alloc, N> const& lhs, unrolled_offset_list<T, Alloc, N> const& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template<class T, class Alloc, std::size_t N>
+    inline bool operator>(unrolled_offset_list<T, Alloc, N> const& lhs, unrolled_offset_list<T, Alloc, N> const& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template<class T, class Alloc, std::size_t N>
+    inline bool operator>=(unrolled_offset_list<T, Alloc, N> const& lhs, unrolled_offset_list<T, Alloc, N> const& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template<class T, class Alloc, std::size_t N>
+    inline void swap(unrolled_offset_list<T, Alloc, N>& lhs, unrolled_offset_list<T, Alloc, N>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,271 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_MEMORY_NODE_ARENA_HPP_INCLUDED
+#define STX_MEMORY_NODE_ARENA_HPP_INCLUDED
+
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace stx
+{
+    /// Carves fixed-size blocks out of large chunks. Freed blocks are kept in
+    /// an intrusive free list and chunks are only returned on `release()` or
+    /// destruction. The block geometry is either given explicitly or fixed by
+    /// the first allocation; requests that don't fit a block go to the heap.
+    class node_arena
+    {
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        struct chunk
+        {
+            chunk* next;
+        };
+
+    public:
+
+        explicit node_arena(std::size_t chunk_size = 64 * 1024) noexcept
+          : node_arena(0, 0, chunk_size)
+        {}
+
+        node_arena(std::size_t block_size, std::size_t block_align, std::size_t chunk_size = 64 * 1024) noexcept
+          : _block_size(), _block_align(), _chunk_size(chunk_size)
+          , _chunks(), _cur(), _end(), _free()
+        {
+            if (block_size)
+                set_geometry(block_size, block_align);
+        }
+
+        node_arena(node_arena&& other) noexcept
+          : _block_size(other._block_size), _block_align(other._block_align)
+          , _chunk_size(other._chunk_size), _chunks(other._chunks)
+          , _cur(other._cur), _end(other._end), _free(other._free)
+        {
+            other._chunks = nullptr;
+            other._cur = nullptr;
+            other._end = nullptr;
+            other._free = nullptr;
+        }
+
+        node_arena(node_arena const&) = delete;
+        node_arena& operator=(node_arena const&) = delete;
+
+        ~node_arena()
+        {
+            release();
+        }
+
+        /// Allocate `n` contiguous objects of `size` bytes each.
+        void* allocate(std::size_t size, std::size_t align, std::size_t n = 1)
+        {
+            if (!_block_size)
+                set_geometry(size, align);
+            if (!fits(size, align))
+                return heap_allocate(size * n, align);
+            if (n == 1 && _free)
+            {
+                free_block* p = _free;
+                _free = p->next;
+                return p;
+            }
+            std::size_t bytes = _block_size * n;
+            if (std::size_t(_end - _cur) < bytes)
+                grow(bytes);
+            void* p = _cur;
+            _cur += bytes;
+            return p;
+        }
+
+        /// Return the memory obtained from `allocate(size, align, n)`.
+        /// Blocks allocated together may be deallocated separately.
+        void deallocate(void* p, std::size_t size, std::size_t align, std::size_t n = 1) noexcept
+        {
+            if (!fits(size, align))
+                return heap_deallocate(p, align);
+            char* block = static_cast<char*>(p);
+            while (n--)
+            {
+                free_block* b = reinterpret_cast<free_block*>(block);
+                b->next = _free;
+                _free = b;
+                block += _block_size;
+            }
+        }
+
+        /// Give all the chunks back, invalidating every block at once.
+        void release() noexcept
+        {
+            chunk* c = _chunks;
+            while (c)
+            {
+                chunk* next = c->next;
+                ::operator delete(c);
+                c = next;
+            }
+            _chunks = nullptr;
+            _cur = nullptr;
+            _end = nullptr;
+            _free = nullptr;
+        }
+
+        std::size_t block_size() const noexcept
+        {
+            return _block_size;
+        }
+
+        std::size_t block_align() const noexcept
+        {
+            return _block_align;
+        }
+
+    private:
+
+        void set_geometry(std::size_t size, std::size_t align) noexcept
+        {
+            if (align < alignof(free_block))
+                align = alignof(free_block);
+            if (size < sizeof(free_block))
+                size = sizeof(free_block);
+            _block_align = align;
+            _block_size = (size + align - 1) / align * align;
+        }
+
+        bool fits(std::size_t size, std::size_t align) const noexcept
+        {
+            return size <= _block_size && align <= _block_align;
+        }
+
+        void grow(std::size_t bytes)
+        {
+            std::size_t chunk_bytes = _chunk_size / _block_size * _block_size;
+            if (bytes < chunk_bytes)
+                bytes = chunk_bytes;
+            char* raw = static_cast<char*>(::operator new(sizeof(chunk) + _block_align - 1 + bytes));
+            // Keep the remainder of the current chunk.
+            for (; std::size_t(_end - _cur) >= _block_size; _cur += _block_size)
+            {
+                free_block* b = reinterpret_cast<free_block*>(_cur);
+                b->next = _free;
+                _free = b;
+            }
+            chunk* c = reinterpret_cast<chunk*>(raw);
+            c->next = _chunks;
+            _chunks = c;
+            std::size_t space = reinterpret_cast<std::uintptr_t>(raw + sizeof(chunk));
+            space = (space + _block_align - 1) / _block_align * _block_align;
+            _cur = reinterpret_cast<char*>(space);
+            _end = _cur + bytes;
+        }
+
+#if defined(__cpp_aligned_new)
+        static void* heap_allocate(std::size_t bytes, std::size_t align)
+        {
+            if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                return ::operator new(bytes, std::align_val_t(align));
+            return ::operator new(bytes);
+        }
+
+        static void heap_deallocate(void* p, std::size_t align) noexcept
+        {
+            if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(p, std::align_val_t(align));
+            else
+                ::operator delete(p);
+        }
+#else
+        // Over-allocate and keep the raw pointer right before the block.
+        static void* heap_allocate(std::size_t bytes, std::size_t align)
+        {
+            if (align <= alignof(std::max_align_t))
+                return ::operator new(bytes);
+            char* raw = static_cast<char*>(::operator new(bytes + sizeof(void*) + align - 1));
+            std::size_t space = reinterpret_cast<std::uintptr_t>(raw + sizeof(void*));
+            space = (space + align - 1) / align * align;
+            void* p = reinterpret_cast<void*>(space);
+            static_cast<void**>(p)[-1] = raw;
+            return p;
+        }
+
+        static void heap_deallocate(void* p, std::size_t align) noexcept
+        {
+            if (align <= alignof(std::max_align_t))
+                ::operator delete(p);
+            else
+                ::operator delete(static_cast<void**>(p)[-1]);
+        }
+#endif
+
+        std::size_t _block_size;
+        std::size_t _block_align;
+        std::size_t _chunk_size;
+        chunk* _chunks;
+        char* _cur;
+        char* _end;
+        free_block* _free;
+    };
+
+    /// A non-owning allocator drawing from a `node_arena`, e.g.
+    /// `offset_list<T, arena_allocator<T>>`.
+    template<class T>
+    class arena_allocator
+    {
+        template<class U>
+        friend class arena_allocator;
+
+        node_arena* _arena;
+
+    public:
+
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        /// Blocks from `allocate(n)` may be deallocated one by one.
+        using divisible_allocation = std::true_type;
+
+        arena_allocator(node_arena& arena) noexcept : _arena(&arena) {}
+
+        template<class U>
+        arena_allocator(arena_allocator<U> const& other) noexcept
+          : _arena(other._arena)
+        {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(_arena->allocate(sizeof(T), alignof(T), n));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            _arena->deallocate(p, sizeof(T), alignof(T), n);
+        }
+
+        node_arena& arena() const noexcept
+        {
+            return *_arena;
+        }
+
+        template<class U>
+        bool operator==(arena_allocator<U> const& other) const noexcept
+        {
+            return _arena == other._arena;
+        }
+
+        template<class U>
+        bool operator!=(arena_allocator<U> const& other) const noexcept
+        {
+            return _arena != other._arena;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
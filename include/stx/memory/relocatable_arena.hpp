@@ -0,0 +1,178 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_MEMORY_RELOCATABLE_ARENA_HPP_INCLUDED
+#define STX_MEMORY_RELOCATABLE_ARENA_HPP_INCLUDED
+
+#include <new>
+#include <cstddef>
+#include <type_traits>
+
+namespace stx
+{
+    /// The header of a buffer that blocks are carved from. Everything,
+    /// including the free list, is addressed relative to the arena itself,
+    /// so the used part of the buffer can be moved with a plain `memcpy`.
+    class relocatable_arena
+    {
+    public:
+
+        /// `reserved` bytes following the arena are left to the owner.
+        relocatable_arena(std::size_t capacity, std::size_t reserved, std::size_t block_size, std::size_t block_align) noexcept
+          : _capacity(capacity), _free()
+        {
+            if (block_align < alignof(std::ptrdiff_t))
+                block_align = alignof(std::ptrdiff_t);
+            if (block_size < sizeof(std::ptrdiff_t))
+                block_size = sizeof(std::ptrdiff_t);
+            _block_align = block_align;
+            _block_size = (block_size + block_align - 1) / block_align * block_align;
+            _used = (reserved + block_align - 1) / block_align * block_align;
+        }
+
+        relocatable_arena(relocatable_arena const&) = delete;
+        relocatable_arena& operator=(relocatable_arena const&) = delete;
+
+        /// Allocate `n` contiguous objects of `size` bytes each.
+        /// \throw std::bad_alloc if the buffer is exhausted.
+        void* allocate(std::size_t size, std::size_t align, std::size_t n = 1)
+        {
+            if (!fits(size, align))
+                throw std::bad_alloc();
+            if (n == 1 && _free)
+            {
+                std::ptrdiff_t* p = block(_free);
+                _free = *p;
+                return p;
+            }
+            std::size_t bytes = _block_size * n;
+            if (_capacity - _used < bytes)
+                throw std::bad_alloc();
+            void* p = block(_used);
+            _used += bytes;
+            return p;
+        }
+
+        /// Blocks allocated together may be deallocated separately.
+        void deallocate(void* p, std::size_t /*size*/, std::size_t /*align*/, std::size_t n = 1) noexcept
+        {
+            std::ptrdiff_t offset = static_cast<char*>(p) - reinterpret_cast<char*>(this);
+            while (n--)
+            {
+                *block(offset) = _free;
+                _free = offset;
+                offset += _block_size;
+            }
+        }
+
+        /// The number of bytes, counted from the arena, that are in use.
+        std::size_t size() const noexcept
+        {
+            return _used;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        /// Tell the arena the size of the buffer after it has been resized
+        /// or copied elsewhere; must not be less than `size()`.
+        void set_capacity(std::size_t capacity) noexcept
+        {
+            _capacity = capacity;
+        }
+
+    private:
+
+        bool fits(std::size_t size, std::size_t align) const noexcept
+        {
+            return size <= _block_size && align <= _block_align;
+        }
+
+        std::ptrdiff_t* block(std::ptrdiff_t offset) noexcept
+        {
+            return reinterpret_cast<std::ptrdiff_t*>(reinterpret_cast<char*>(this) + offset);
+        }
+
+        std::size_t _capacity;
+        std::size_t _used;
+        std::size_t _block_size;
+        std::size_t _block_align;
+        std::ptrdiff_t _free;
+    };
+
+    /// An allocator that refers to its `relocatable_arena` by a self-relative
+    /// offset, so it stays valid when moved along with the arena's buffer.
+    template<class T>
+    class relocatable_allocator
+    {
+        std::ptrdiff_t _offset;
+
+        static std::ptrdiff_t offset(void const* from, void const* to) noexcept
+        {
+            return static_cast<char const*>(to) - static_cast<char const*>(from);
+        }
+
+    public:
+
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        /// Blocks from `allocate(n)` may be deallocated one by one.
+        using divisible_allocation = std::true_type;
+
+        relocatable_allocator(relocatable_arena& arena) noexcept
+          : _offset(offset(this, &arena))
+        {}
+
+        relocatable_allocator(relocatable_allocator const& other) noexcept
+          : _offset(offset(this, &other.arena()))
+        {}
+
+        template<class U>
+        relocatable_allocator(relocatable_allocator<U> const& other) noexcept
+          : _offset(offset(this, &other.arena()))
+        {}
+
+        relocatable_allocator& operator=(relocatable_allocator const& other) noexcept
+        {
+            _offset = offset(this, &other.arena());
+            return *this;
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(arena().allocate(sizeof(T), alignof(T), n));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            arena().deallocate(p, sizeof(T), alignof(T), n);
+        }
+
+        relocatable_arena& arena() const noexcept
+        {
+            return *reinterpret_cast<relocatable_arena*>(
+                const_cast<char*>(reinterpret_cast<char const*>(this)) + _offset);
+        }
+
+        template<class U>
+        bool operator==(relocatable_allocator<U> const& other) const noexcept
+        {
+            return &arena() == &other.arena();
+        }
+
+        template<class U>
+        bool operator!=(relocatable_allocator<U> const& other) const noexcept
+        {
+            return &arena() != &other.arena();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
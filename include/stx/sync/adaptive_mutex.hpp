@@ -0,0 +1,106 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_ADAPTIVE_MUTEX_HPP_INCLUDED
+#define STX_SYNC_ADAPTIVE_MUTEX_HPP_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <stx/sync/futex.hpp>
+#include <stx/sync/backoff.hpp>
+
+namespace stx
+{
+    /// A mutex that spins for a while before blocking on a futex. The number
+    /// of spins is tuned to how long acquisitions used to take to succeed
+    /// by spinning, which tracks the typical hold time of the lock.
+    ///
+    /// The whole state is a single 32-bit word, so it can be embedded in
+    /// each element of a large array.
+    class adaptive_mutex
+    {
+        // The spin budget is kept in the upper 16 bits and only changed by
+        // the owner.
+        enum state : std::uint32_t { locked = 1, waiters = 2, budget_shift = 16 };
+
+        std::atomic<std::uint32_t> _state;
+
+    public:
+
+        /// The upper bound of the spin budget.
+        static constexpr std::uint32_t max_spins = 1000;
+
+        adaptive_mutex() noexcept : _state(0) {}
+
+        adaptive_mutex(adaptive_mutex const&) = delete;
+        adaptive_mutex& operator=(adaptive_mutex const&) = delete;
+
+        void lock() noexcept
+        {
+            std::uint32_t s = _state.load(std::memory_order_relaxed);
+            if ((s & locked) || !_state.compare_exchange_weak(s, s | locked, std::memory_order_acquire, std::memory_order_relaxed))
+                lock_slow();
+        }
+
+        bool try_lock() noexcept
+        {
+            std::uint32_t s = _state.load(std::memory_order_relaxed);
+            return !(s & locked) && _state.compare_exchange_strong(s, s | locked, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void unlock() noexcept
+        {
+            if (_state.fetch_and(~std::uint32_t(locked | waiters), std::memory_order_release) & waiters)
+                futex_wake_one(_state);
+        }
+
+        /// The current spin budget, for diagnostics.
+        std::uint32_t spin_budget() const noexcept
+        {
+            return _state.load(std::memory_order_relaxed) >> budget_shift;
+        }
+
+    private:
+
+        void lock_slow() noexcept
+        {
+            std::uint32_t budget = spin_budget();
+            std::uint32_t limit = budget * 2 + 10;
+            if (limit > max_spins)
+                limit = max_spins;
+            for (std::uint32_t n = 1; n <= limit; ++n)
+            {
+                cpu_relax();
+                std::uint32_t s = _state.load(std::memory_order_relaxed);
+                if (!(s & locked) && _state.compare_exchange_weak(s, s | locked, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    adapt(n);
+                    return;
+                }
+            }
+            // The lock was held for at least the whole spin, so count it as
+            // such once we get it.
+            std::uint32_t s = _state.fetch_or(locked | waiters, std::memory_order_acquire);
+            while (s & locked)
+            {
+                futex_wait(_state, s | locked | waiters);
+                s = _state.fetch_or(locked | waiters, std::memory_order_acquire);
+            }
+            adapt(limit);
+        }
+
+        // Move the budget an eighth of the way towards `spins`.
+        void adapt(std::uint32_t spins) noexcept
+        {
+            std::uint32_t budget = spin_budget();
+            std::uint32_t delta = std::uint32_t(std::int32_t(spins - budget) / 8);
+            if (delta)
+                _state.fetch_add(delta << budget_shift, std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_ASYNC_EVENT_HPP_INCLUDED
+#define STX_SYNC_ASYNC_EVENT_HPP_INCLUDED
+
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#define STX_SYNC_HAS_COROUTINE
+#endif
+#endif
+
+#if defined(STX_SYNC_HAS_COROUTINE)
+#include <atomic>
+#include <coroutine>
+
+namespace stx
+{
+    /// A manual-reset event that coroutines can `co_await` without blocking
+    /// the thread. Suspended coroutines are kept in an intrusive lock-free
+    /// list of their awaiters, so waiting does not allocate.
+    class async_event
+    {
+        // Holds `this` when set, otherwise the last awaiter pushed, or null.
+        mutable std::atomic<void*> _state;
+
+    public:
+
+        class awaiter
+        {
+            friend class async_event;
+
+            async_event const& _event;
+            awaiter* _next;
+            std::coroutine_handle<> _handle;
+
+        public:
+
+            explicit awaiter(async_event const& event) noexcept
+              : _event(event), _next(), _handle()
+            {}
+
+            bool await_ready() const noexcept
+            {
+                return _event.is_set();
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle) noexcept
+            {
+                _handle = handle;
+                void const* const set_state = &_event;
+                void* old = _event._state.load(std::memory_order_acquire);
+                do
+                {
+                    if (old == set_state)
+                        return false;
+                    _next = static_cast<awaiter*>(old);
+                } while (!_event._state.compare_exchange_weak(old, this, std::memory_order_release, std::memory_order_acquire));
+                return true;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        explicit async_event(bool initially_set = false) noexcept
+          : _state(initially_set? this : nullptr)
+        {}
+
+        async_event(async_event const&) = delete;
+        async_event& operator=(async_event const&) = delete;
+
+        bool is_set() const noexcept
+        {
+            return _state.load(std::memory_order_acquire) == this;
+        }
+
+        /// Resume the waiting coroutines inline, in the order they arrived.
+        void set() noexcept
+        {
+            set([](std::coroutine_handle<> handle)
+            {
+                handle.resume();
+            });
+        }
+
+        /// Hand each waiting coroutine to `executor`, a callable taking a
+        /// `std::coroutine_handle<>` that resumes it, e.g. on a thread pool.
+        template<class Executor>
+        void set(Executor&& executor)
+        {
+            void* old = _state.exchange(this, std::memory_order_acq_rel);
+            if (old == this)
+                return;
+            // Reverse the list to resume in FIFO order.
+            awaiter* w = static_cast<awaiter*>(old);
+            awaiter* list = nullptr;
+            while (w)
+            {
+                awaiter* next = w->_next;
+                w->_next = list;
+                list = w;
+                w = next;
+            }
+            while (list)
+            {
+                // The awaiter may be gone once its coroutine is resumed.
+                awaiter* next = list->_next;
+                executor(list->_handle);
+                list = next;
+            }
+        }
+
+        /// Clear the event if it is set.
+        void reset() noexcept
+        {
+            void* old = this;
+            _state.compare_exchange_strong(old, nullptr, std::memory_order_relaxed);
+        }
+
+        awaiter operator co_await() const noexcept
+        {
+            return awaiter(*this);
+        }
+    };
+}
+#endif
+
+#endif
\ No newline at end of file
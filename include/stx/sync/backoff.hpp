@@ -0,0 +1,67 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_BACKOFF_HPP_INCLUDED
+#define STX_SYNC_BACKOFF_HPP_INCLUDED
+
+#include <thread>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+namespace stx
+{
+    /// Tell the CPU that we are in a spin-wait loop, which saves power and
+    /// leaves the pipeline to the sibling hyperthread.
+    inline void cpu_relax() noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+        __yield();
+#elif defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    /// A backoff policy that only issues `cpu_relax()`.
+    struct pause_backoff
+    {
+        void operator()() noexcept
+        {
+            cpu_relax();
+        }
+    };
+
+    /// A backoff policy that pauses `Initial` times at first, doubling on
+    /// each call up to `Limit`, and yields the thread from then on.
+    /// A fresh object is used for each wait.
+    template<unsigned Initial = 4, unsigned Limit = 1024>
+    class exponential_backoff
+    {
+        static_assert(Initial > 0 && Initial <= Limit, "invalid spin budget");
+
+        unsigned _spins = Initial;
+
+    public:
+
+        void operator()() noexcept
+        {
+            if (_spins <= Limit)
+            {
+                for (unsigned i = _spins; i; --i)
+                    cpu_relax();
+                _spins *= 2;
+            }
+            else
+                std::this_thread::yield();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
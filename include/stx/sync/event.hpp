@@ -7,37 +7,408 @@
 #ifndef STX_SYNC_EVENT_HPP_INCLUDED
 #define STX_SYNC_EVENT_HPP_INCLUDED
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
-#include <condition_variable>
+#include <stx/sync/futex.hpp>
+#include <stx/sync/spinlock.hpp>
 
 namespace stx
 {
+    class event;
+}
+
+namespace stx { namespace event_detail
+{
+    struct bucket;
+
+    // A thread blocked in `wait_any`/`wait_all` registers with each event,
+    // naming the bucket word it sleeps on.
+    struct registration
+    {
+        event const* ev;
+        bucket* home;
+        registration* next;
+        registration** link;
+    };
+
+    // Registrations are hashed by event address into buckets, so `set()`
+    // only looks at the waiters of events sharing its bucket, and only wakes
+    // the threads sleeping on the words those waiters named.
+    struct alignas(64) bucket
+    {
+        spinlock lock;
+        registration* head = nullptr;
+        std::atomic<std::uint32_t> seq{0};
+    };
+
+    constexpr std::size_t bucket_count = 64;
+
+    inline bucket* buckets() noexcept
+    {
+        static bucket table[bucket_count];
+        return table;
+    }
+
+    inline std::size_t bucket_index(event const* ev) noexcept
+    {
+        std::uintptr_t h = reinterpret_cast<std::uintptr_t>(ev);
+        return (h >> 2 ^ h >> 8) % bucket_count;
+    }
+
+    inline void notify(event const* ev) noexcept;
+
+    template<std::size_t N, class Wait>
+    std::size_t wait_multi(event* const (&events)[N], bool all, Wait wait) noexcept;
+}}
+
+namespace stx
+{
+    /// A manual-reset event on a single futex word. `wait()` on a set event
+    /// is one acquire load, and `set()` only makes a system call when some
+    /// thread is blocked.
     class event
     {
-        bool _not_ready;
-        std::mutex _mtx;
-        std::condition_variable _cond;
+        enum state : std::uint32_t { signaled = 1, waiters = 2, multi_waiters = 4 };
+
+        std::atomic<std::uint32_t> _state;
+
+        template<std::size_t N, class Wait>
+        friend std::size_t event_detail::wait_multi(event* const (&)[N], bool, Wait) noexcept;
+
+    public:
+
+        event() noexcept : _state(0) {}
+
+        event(event const&) = delete;
+        event& operator=(event const&) = delete;
+
+        void set() noexcept
+        {
+            std::uint32_t s = _state.exchange(signaled, std::memory_order_acq_rel);
+            if (s & waiters)
+                futex_wake_all(_state);
+            if (s & multi_waiters)
+                event_detail::notify(this);
+        }
+
+        void reset() noexcept
+        {
+            _state.fetch_and(~signaled, std::memory_order_relaxed);
+        }
+
+        bool try_wait() const noexcept
+        {
+            return _state.load(std::memory_order_acquire) & signaled;
+        }
+
+        void wait() noexcept
+        {
+            if (!try_wait())
+            {
+                wait_slow([this](std::uint32_t s)
+                {
+                    futex_wait(_state, s);
+                    return true;
+                });
+            }
+        }
+
+        /// \return false on timeout.
+        template<class Rep, class Period>
+        bool wait_for(std::chrono::duration<Rep, Period> const& duration) noexcept
+        {
+            return wait_until(std::chrono::steady_clock::now() + duration);
+        }
+
+        /// \return false on timeout.
+        template<class Clock, class Duration>
+        bool wait_until(std::chrono::time_point<Clock, Duration> const& deadline) noexcept
+        {
+            return try_wait() || wait_slow([this, &deadline](std::uint32_t s)
+            {
+                return futex_wait_until(_state, s, deadline);
+            });
+        }
+
+    private:
+
+        template<class Wait>
+        bool wait_slow(Wait wait) noexcept
+        {
+            std::uint32_t s = _state.load(std::memory_order_acquire);
+            while (!(s & signaled))
+            {
+                if (!(s & waiters) && !_state.compare_exchange_weak(s, s | waiters, std::memory_order_acquire))
+                    continue;
+                if (!wait(s | waiters))
+                    return try_wait();
+                s = _state.load(std::memory_order_acquire);
+            }
+            return true;
+        }
+
+        // Ask `set()` to notify the registered waiters, and tell whether we
+        // are set already.
+        bool arm_multi() noexcept
+        {
+            return _state.fetch_or(multi_waiters, std::memory_order_acq_rel) & signaled;
+        }
+    };
+
+    /// An event that lets exactly one waiter through per `set()` and
+    /// resets itself. Setting an already set event has no effect.
+    class auto_reset_event
+    {
+        // Bit 0 is the signal, the rest counts the blocked waiters.
+        enum state : std::uint32_t { signaled = 1, waiter = 2 };
+
+        std::atomic<std::uint32_t> _state;
 
     public:
 
-        event() : _not_ready(true) {}
+        explicit auto_reset_event(bool initially_set = false) noexcept
+          : _state(initially_set? signaled : 0u)
+        {}
+
+        auto_reset_event(auto_reset_event const&) = delete;
+        auto_reset_event& operator=(auto_reset_event const&) = delete;
+
+        void set() noexcept
+        {
+            std::uint32_t s = _state.fetch_or(signaled, std::memory_order_release);
+            if (!(s & signaled) && s >= waiter)
+                futex_wake_one(_state);
+        }
+
+        void reset() noexcept
+        {
+            _state.fetch_and(~signaled, std::memory_order_relaxed);
+        }
+
+        void wait() noexcept
+        {
+            std::uint32_t s = _state.load(std::memory_order_relaxed);
+            if (!(s & signaled) || !_state.compare_exchange_strong(s, s & ~signaled, std::memory_order_acquire))
+                wait_slow();
+        }
+
+    private:
 
-        void set()
+        void wait_slow() noexcept
         {
+            std::uint32_t s = _state.fetch_add(waiter, std::memory_order_relaxed) + waiter;
+            for (;;)
             {
-                std::unique_lock<std::mutex> lock(_mtx);
-                _not_ready = false;
+                if (s & signaled)
+                {
+                    if (_state.compare_exchange_weak(s, s - signaled - waiter, std::memory_order_acquire))
+                        return;
+                }
+                else
+                {
+                    futex_wait(_state, s);
+                    s = _state.load(std::memory_order_relaxed);
+                }
             }
-            _cond.notify_all();
         }
+    };
+
+    /// An event that is set once `signal()` has been called `count` times,
+    /// e.g. to join forked tasks. `reset(count)` rearms it.
+    class countdown_event
+    {
+        // The remaining count is stored above the waiters bit.
+        enum state : std::uint32_t { waiters = 1, unit = 2 };
+
+        std::atomic<std::uint32_t> _state;
+
+    public:
+
+        explicit countdown_event(std::uint32_t count) noexcept
+          : _state(count * unit)
+        {}
+
+        countdown_event(countdown_event const&) = delete;
+        countdown_event& operator=(countdown_event const&) = delete;
 
-        void wait()
+        /// Count down by `n`, which must not exceed the remaining count.
+        void signal(std::uint32_t n = 1) noexcept
         {
-            std::unique_lock<std::mutex> lock(_mtx);
-            while (_not_ready)
-                _cond.wait(lock);
+            std::uint32_t s = _state.fetch_sub(n * unit, std::memory_order_acq_rel);
+            if (s / unit == n && (s & waiters))
+                futex_wake_all(_state);
+        }
+
+        /// Rearm the event; must not race with `wait()` or `signal()`.
+        void reset(std::uint32_t count) noexcept
+        {
+            _state.store(count * unit, std::memory_order_relaxed);
+        }
+
+        void wait() noexcept
+        {
+            if (_state.load(std::memory_order_acquire) >= unit)
+                wait_slow();
+        }
+
+    private:
+
+        void wait_slow() noexcept
+        {
+            std::uint32_t s = _state.load(std::memory_order_acquire);
+            while (s >= unit)
+            {
+                if (!(s & waiters) && !_state.compare_exchange_weak(s, s | waiters, std::memory_order_acquire))
+                    continue;
+                futex_wait(_state, s | waiters);
+                s = _state.load(std::memory_order_acquire);
+            }
         }
     };
+
+    namespace event_detail
+    {
+        inline void notify(event const* ev) noexcept
+        {
+            static_assert(bucket_count <= 64, "one bit per bucket");
+            std::uint64_t homes = 0;
+            bucket& b = buckets()[bucket_index(ev)];
+            {
+                std::lock_guard<spinlock> lock(b.lock);
+                for (registration* r = b.head; r; r = r->next)
+                {
+                    if (r->ev == ev)
+                        homes |= std::uint64_t(1) << (r->home - buckets());
+                }
+            }
+            // The bucket words are never destroyed, so wake outside the lock.
+            for (std::size_t i = 0; homes; ++i, homes >>= 1)
+            {
+                if (homes & 1)
+                {
+                    buckets()[i].seq.fetch_add(1, std::memory_order_release);
+                    futex_wake_all(buckets()[i].seq);
+                }
+            }
+        }
+
+        template<std::size_t N, class Wait>
+        std::size_t wait_multi(event* const (&events)[N], bool all, Wait wait) noexcept
+        {
+            // On timeout, return N, or N + 1 if `all`.
+            std::size_t unset = 0;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                if (!events[i]->try_wait())
+                    ++unset;
+                else if (!all)
+                    return i;
+            }
+            if (!unset)
+                return N;
+
+            // A registration made before arming the event is seen by the
+            // `set()` that finds it armed.
+            bucket& home = buckets()[bucket_index(events[0])];
+            registration regs[N];
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                registration& r = regs[i];
+                r.ev = events[i];
+                r.home = &home;
+                bucket& b = buckets()[bucket_index(r.ev)];
+                std::lock_guard<spinlock> lock(b.lock);
+                r.next = b.head;
+                r.link = &b.head;
+                if (b.head)
+                    b.head->link = &r.next;
+                b.head = &r;
+            }
+
+            std::size_t result = all? N + 1 : N;
+            bool timed_out = false;
+            for (;;)
+            {
+                std::uint32_t seq = home.seq.load(std::memory_order_acquire);
+                unset = 0;
+                std::size_t i = 0;
+                for (; i != N; ++i)
+                {
+                    if (!events[i]->arm_multi())
+                        ++unset;
+                    else if (!all)
+                        break;
+                }
+                if (all? !unset : i != N)
+                {
+                    result = all? N : i;
+                    break;
+                }
+                if (timed_out)
+                    break;
+                timed_out = !wait(home.seq, seq);
+            }
+
+            for (registration& r : regs)
+            {
+                std::lock_guard<spinlock> lock(buckets()[bucket_index(r.ev)].lock);
+                *r.link = r.next;
+                if (r.next)
+                    r.next->link = r.link;
+            }
+            return result;
+        }
+    }
+
+    /// Block until one of `events` is set, and return its index.
+    template<class... Events>
+    std::size_t wait_any(Events&... events) noexcept
+    {
+        event* const list[] = {&events...};
+        return event_detail::wait_multi(list, false, [](std::atomic<std::uint32_t>& word, std::uint32_t seq)
+        {
+            futex_wait(word, seq);
+            return true;
+        });
+    }
+
+    /// Like `wait_any`, but returns `sizeof...(events)` after `deadline`.
+    template<class Clock, class Duration, class... Events>
+    std::size_t wait_any_until(std::chrono::time_point<Clock, Duration> const& deadline, Events&... events) noexcept
+    {
+        event* const list[] = {&events...};
+        return event_detail::wait_multi(list, false, [&deadline](std::atomic<std::uint32_t>& word, std::uint32_t seq)
+        {
+            return futex_wait_until(word, seq, deadline);
+        });
+    }
+
+    /// Block until each of `events` has been seen set in the same pass.
+    template<class... Events>
+    void wait_all(Events&... events) noexcept
+    {
+        event* const list[] = {&events...};
+        event_detail::wait_multi(list, true, [](std::atomic<std::uint32_t>& word, std::uint32_t seq)
+        {
+            futex_wait(word, seq);
+            return true;
+        });
+    }
+
+    /// Like `wait_all`, but gives up after `deadline`.
+    /// \return false on timeout.
+    template<class Clock, class Duration, class... Events>
+    bool wait_all_until(std::chrono::time_point<Clock, Duration> const& deadline, Events&... events) noexcept
+    {
+        event* const list[] = {&events...};
+        return event_detail::wait_multi(list, true, [&deadline](std::atomic<std::uint32_t>& word, std::uint32_t seq)
+        {
+            return futex_wait_until(word, seq, deadline);
+        }) == sizeof...(Events);
+    }
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_FUTEX_HPP_INCLUDED
+#define STX_SYNC_FUTEX_HPP_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#if defined(__linux__)
+#include <ctime>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#define STX_SYNC_HAS_LINUX_FUTEX
+#endif
+
+namespace stx { namespace futex_detail
+{
+#if defined(STX_SYNC_HAS_LINUX_FUTEX)
+    inline long futex(std::atomic<std::uint32_t>& word, int op, std::uint32_t val, timespec const* timeout) noexcept
+    {
+        return ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), op | FUTEX_PRIVATE_FLAG, val, timeout, nullptr, 0);
+    }
+#endif
+}}
+
+namespace stx
+{
+    /// Block while `word` holds `expected`, until woken by `futex_wake_*`.
+    /// May return spuriously; the caller must recheck its condition.
+    inline void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected) noexcept
+    {
+#if defined(STX_SYNC_HAS_LINUX_FUTEX)
+        futex_detail::futex(word, FUTEX_WAIT, expected, nullptr);
+#elif defined(__cpp_lib_atomic_wait)
+        word.wait(expected, std::memory_order_relaxed);
+#else
+        while (word.load(std::memory_order_relaxed) == expected)
+            std::this_thread::yield();
+#endif
+    }
+
+    /// Like `futex_wait`, but gives up after `timeout`.
+    /// \return false if the timeout has expired.
+    template<class Rep, class Period>
+    bool futex_wait_for(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::chrono::duration<Rep, Period> const& timeout) noexcept
+    {
+        using namespace std::chrono;
+        if (timeout <= timeout.zero())
+            return false;
+#if defined(STX_SYNC_HAS_LINUX_FUTEX)
+        // Longer waits are cut short, which looks like a spurious wakeup.
+        constexpr hours max_wait(24 * 365);
+        bool clamped = !(timeout < max_wait);
+        auto ns = (clamped? nanoseconds(max_wait) : duration_cast<nanoseconds>(timeout)).count();
+        timespec ts;
+        ts.tv_sec = time_t(ns / 1000000000);
+        ts.tv_nsec = long(ns % 1000000000);
+        return futex_detail::futex(word, FUTEX_WAIT, expected, &ts) == 0 || errno != ETIMEDOUT || clamped;
+#else
+        // Neither the standard nor other platforms offer a timed wait on an
+        // address, so poll.
+        auto deadline = steady_clock::now() + timeout;
+        while (word.load(std::memory_order_relaxed) == expected)
+        {
+            if (steady_clock::now() >= deadline)
+                return false;
+            std::this_thread::yield();
+        }
+        return true;
+#endif
+    }
+
+    /// \return false if `deadline` has passed.
+    template<class Clock, class Duration>
+    bool futex_wait_until(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::chrono::time_point<Clock, Duration> const& deadline) noexcept
+    {
+        return futex_wait_for(word, expected, deadline - Clock::now());
+    }
+
+    inline void futex_wake_one(std::atomic<std::uint32_t>& word) noexcept
+    {
+#if defined(STX_SYNC_HAS_LINUX_FUTEX)
+        futex_detail::futex(word, FUTEX_WAKE, 1, nullptr);
+#elif defined(__cpp_lib_atomic_wait)
+        word.notify_one();
+#else
+        (void)word;
+#endif
+    }
+
+    inline void futex_wake_all(std::atomic<std::uint32_t>& word) noexcept
+    {
+#if defined(STX_SYNC_HAS_LINUX_FUTEX)
+        futex_detail::futex(word, FUTEX_WAKE, INT_MAX, nullptr);
+#elif defined(__cpp_lib_atomic_wait)
+        word.notify_all();
+#else
+        (void)word;
+#endif
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,266 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_LOCK_STATS_HPP_INCLUDED
+#define STX_SYNC_LOCK_STATS_HPP_INCLUDED
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace stx
+{
+    class lock_stats;
+}
+
+namespace stx { namespace lock_stats_detail
+{
+    struct registry
+    {
+        std::mutex mutex;
+        lock_stats* head = nullptr;
+    };
+
+    inline registry& get_registry()
+    {
+        static registry r;
+        return r;
+    }
+
+    // Bucket i holds values in [2^(i-1), 2^i), bucket 0 holds 0.
+    inline unsigned log2_bucket(std::uint64_t value) noexcept
+    {
+        unsigned i = 0;
+        for (; value; value >>= 1)
+            ++i;
+        return i;
+    }
+
+    using counter = std::atomic<std::uint64_t>;
+
+    inline void bump(counter& c) noexcept
+    {
+        c.fetch_add(1, std::memory_order_relaxed);
+    }
+}}
+
+namespace stx
+{
+    /// A statistics policy for `basic_spinlock` and `basic_shared_spinlock`,
+    /// e.g. `basic_spinlock<exponential_backoff<>, lock_stats>`. Each lock
+    /// registers itself so that all the live locks can be enumerated.
+    ///
+    /// Counters are updated with relaxed atomics; the hold time is only
+    /// measured for exclusive ownership.
+    class lock_stats
+    {
+        using counter = lock_stats_detail::counter;
+
+    public:
+
+        using stamp = std::uint64_t;
+
+        static constexpr unsigned buckets = 65;
+
+        static stamp now() noexcept
+        {
+            using namespace std::chrono;
+            return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+        }
+
+        explicit lock_stats(char const* name = nullptr)
+          : _name(name), _prev(nullptr)
+        {
+            reset();
+            auto& r = lock_stats_detail::get_registry();
+            std::lock_guard<std::mutex> guard(r.mutex);
+            _next = r.head;
+            if (_next)
+                _next->_prev = this;
+            r.head = this;
+        }
+
+        lock_stats(lock_stats const&) = delete;
+        lock_stats& operator=(lock_stats const&) = delete;
+
+        ~lock_stats()
+        {
+            auto& r = lock_stats_detail::get_registry();
+            std::lock_guard<std::mutex> guard(r.mutex);
+            if (_prev)
+                _prev->_next = _next;
+            else
+                r.head = _next;
+            if (_next)
+                _next->_prev = _prev;
+        }
+
+        void on_lock(std::size_t spins, stamp start, bool contended) noexcept
+        {
+            lock_stats_detail::bump(_acquisitions);
+            _hold_start.store(record_wait(spins, start, contended), std::memory_order_relaxed);
+        }
+
+        void on_unlock() noexcept
+        {
+            stamp held = now() - _hold_start.load(std::memory_order_relaxed);
+            if (held > _max_hold.load(std::memory_order_relaxed))
+                _max_hold.store(held, std::memory_order_relaxed);
+        }
+
+        void on_lock_shared(std::size_t spins, stamp start, bool contended) noexcept
+        {
+            lock_stats_detail::bump(_shared_acquisitions);
+            record_wait(spins, start, contended);
+        }
+
+        void on_unlock_shared() noexcept {}
+
+        /// Only meant to be set before the lock is shared across threads.
+        void set_name(char const* name) noexcept
+        {
+            _name = name;
+        }
+
+        char const* name() const noexcept
+        {
+            return _name;
+        }
+
+        std::uint64_t acquisitions() const noexcept
+        {
+            return _acquisitions.load(std::memory_order_relaxed);
+        }
+
+        std::uint64_t shared_acquisitions() const noexcept
+        {
+            return _shared_acquisitions.load(std::memory_order_relaxed);
+        }
+
+        /// The number of acquisitions whose first attempt failed.
+        std::uint64_t contended() const noexcept
+        {
+            return _contended.load(std::memory_order_relaxed);
+        }
+
+        /// The number of acquisitions whose backoff was called in
+        /// [2^(i-1), 2^i) times, or 0 times for `i == 0`.
+        std::uint64_t spin_histogram(unsigned i) const noexcept
+        {
+            return _spins[i].load(std::memory_order_relaxed);
+        }
+
+        /// Like `spin_histogram`, for the waiting time in nanoseconds.
+        std::uint64_t wait_histogram(unsigned i) const noexcept
+        {
+            return _waits[i].load(std::memory_order_relaxed);
+        }
+
+        /// An upper bound of the `p`-th percentile (0 to 100) of the waiting
+        /// time in nanoseconds, to within a factor of 2.
+        std::uint64_t wait_percentile(double p) const noexcept
+        {
+            std::uint64_t total = 0;
+            for (unsigned i = 0; i != buckets; ++i)
+                total += wait_histogram(i);
+            if (!total)
+                return 0;
+            std::uint64_t rank = std::uint64_t(total * p / 100);
+            // The 100th percentile is the last sample, not one past it.
+            if (rank > total - 1)
+                rank = total - 1;
+            std::uint64_t seen = 0;
+            for (unsigned i = 0; i != buckets; ++i)
+            {
+                seen += wait_histogram(i);
+                if (seen > rank)
+                    return i? (i < 64? (std::uint64_t(1) << i) - 1 : ~std::uint64_t(0)) : 0;
+            }
+            return 0;
+        }
+
+        std::uint64_t max_hold_time() const noexcept
+        {
+            return _max_hold.load(std::memory_order_relaxed);
+        }
+
+        void reset() noexcept
+        {
+            _acquisitions.store(0, std::memory_order_relaxed);
+            _shared_acquisitions.store(0, std::memory_order_relaxed);
+            _contended.store(0, std::memory_order_relaxed);
+            _max_hold.store(0, std::memory_order_relaxed);
+            _hold_start.store(0, std::memory_order_relaxed);
+            for (auto& c : _spins)
+                c.store(0, std::memory_order_relaxed);
+            for (auto& c : _waits)
+                c.store(0, std::memory_order_relaxed);
+        }
+
+        /// Call `f(lock_stats const&)` for each live instance. The registry
+        /// is locked meanwhile, so `f` must not create or destroy any.
+        template<class F>
+        static void for_each(F&& f)
+        {
+            auto& r = lock_stats_detail::get_registry();
+            std::lock_guard<std::mutex> guard(r.mutex);
+            for (lock_stats const* p = r.head; p; p = p->_next)
+                f(*p);
+        }
+
+        /// Write a line per live instance.
+        static void dump(std::ostream& os)
+        {
+            for_each([&os](lock_stats const& s)
+            {
+                if (s.name())
+                    os << s.name();
+                else
+                    os << static_cast<void const*>(&s);
+                os << ": acquisitions " << s.acquisitions()
+                   << ", shared " << s.shared_acquisitions()
+                   << ", contended " << s.contended()
+                   << ", wait p50 " << s.wait_percentile(50)
+                   << "ns, p99 " << s.wait_percentile(99)
+                   << "ns, max hold " << s.max_hold_time() << "ns\n";
+            });
+        }
+
+    private:
+
+        // Returns the time of acquisition.
+        stamp record_wait(std::size_t spins, stamp start, bool contended) noexcept
+        {
+            using namespace lock_stats_detail;
+            bump(_spins[log2_bucket(spins)]);
+            if (!contended)
+            {
+                bump(_waits[0]);
+                return start;
+            }
+            bump(_contended);
+            stamp t = now();
+            bump(_waits[log2_bucket(t - start)]);
+            return t;
+        }
+
+        char const* _name;
+        lock_stats* _prev;
+        lock_stats* _next;
+        counter _acquisitions;
+        counter _shared_acquisitions;
+        counter _contended;
+        counter _max_hold;
+        counter _hold_start;
+        counter _spins[buckets];
+        counter _waits[buckets];
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,234 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_QUEUE_LOCK_HPP_INCLUDED
+#define STX_SYNC_QUEUE_LOCK_HPP_INCLUDED
+
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stx/sync/backoff.hpp>
+
+namespace stx { namespace queue_lock_detail
+{
+    struct alignas(64) clh_node
+    {
+        // Null while the owner holds or waits for the lock, the node itself
+        // once released, or the node to wait on instead once the owner has
+        // given up its place in the queue.
+        std::atomic<clh_node*> state;
+        clh_node* next = nullptr;
+
+        clh_node() noexcept : state(this) {}
+    };
+
+    // Nodes are never freed, so only allocation has to care about the
+    // alignment when aligned new is not available.
+    inline clh_node* new_node()
+    {
+#if defined(__cpp_aligned_new)
+        return new clh_node;
+#else
+        constexpr std::size_t align = alignof(clh_node);
+        char* raw = static_cast<char*>(::operator new(sizeof(clh_node) + align - 1));
+        std::uintptr_t space = reinterpret_cast<std::uintptr_t>(raw);
+        return ::new(reinterpret_cast<void*>((space + align - 1) / align * align)) clh_node;
+#endif
+    }
+
+    // Nodes of exited threads and destroyed locks are kept for reuse instead
+    // of being freed, since `try_lock` may still peek at a node it does not
+    // own.
+    struct node_pool
+    {
+        std::mutex mutex;
+        clh_node* head = nullptr;
+    };
+
+    inline node_pool& get_pool()
+    {
+        static node_pool pool;
+        return pool;
+    }
+
+    inline void recycle(clh_node* node)
+    {
+        auto& pool = get_pool();
+        std::lock_guard<std::mutex> guard(pool.mutex);
+        node->next = pool.head;
+        pool.head = node;
+    }
+
+    inline clh_node* take_node()
+    {
+        {
+            auto& pool = get_pool();
+            std::lock_guard<std::mutex> guard(pool.mutex);
+            if (clh_node* node = pool.head)
+            {
+                pool.head = node->next;
+                return node;
+            }
+        }
+        return new_node();
+    }
+
+    struct spare_holder
+    {
+        clh_node* node = nullptr;
+
+        ~spare_holder()
+        {
+            if (node)
+                recycle(node);
+        }
+    };
+
+    // Each thread keeps one node to enqueue with, and takes over the node
+    // of its predecessor in exchange, so nodes circulate among the threads
+    // and the locks without further allocation.
+    inline clh_node*& spare_node()
+    {
+        static thread_local spare_holder holder;
+        if (!holder.node)
+            holder.node = take_node();
+        return holder.node;
+    }
+
+    // Wait for the release of `pred`, skipping the nodes given up on, and
+    // return the released one.
+    inline clh_node* wait_for(clh_node* pred)
+    {
+        for (;;)
+        {
+            clh_node* state = pred->state.load(std::memory_order_acquire);
+            if (state == pred)
+                return pred;
+            if (state)
+            {
+                // We were the only one left to look at it.
+                recycle(pred);
+                pred = state;
+            }
+            else
+                cpu_relax();
+        }
+    }
+}}
+
+namespace stx
+{
+    /// A fair spinlock serving threads in the order of their tickets. A
+    /// waiter pauses in proportion to its distance from the head.
+    class ticket_lock
+    {
+        std::atomic<std::uint32_t> _next;
+        std::atomic<std::uint32_t> _serving;
+
+    public:
+        ticket_lock() noexcept : _next(0), _serving(0) {}
+        ticket_lock(ticket_lock const&) = delete;
+        ticket_lock& operator=(ticket_lock const&) = delete;
+
+        void lock() noexcept
+        {
+            std::uint32_t ticket = _next.fetch_add(1, std::memory_order_relaxed);
+            for (;;)
+            {
+                std::uint32_t serving = _serving.load(std::memory_order_acquire);
+                if (serving == ticket)
+                    return;
+                for (std::uint32_t i = ticket - serving; i; --i)
+                    cpu_relax();
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            std::uint32_t serving = _serving.load(std::memory_order_acquire);
+            std::uint32_t ticket = serving;
+            return _next.compare_exchange_strong(ticket, serving + 1, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void unlock() noexcept
+        {
+            _serving.store(_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+    };
+
+    /// A fair CLH queue lock: each waiter spins on a flag of its own cache
+    /// line, set by its predecessor only, so a release touches one waiter.
+    /// Usable with `std::lock_guard`; a thread may hold several at a time.
+    class clh_lock
+    {
+        using node_t = queue_lock_detail::clh_node;
+
+        std::atomic<node_t*> _tail;
+        node_t* _owner;
+
+    public:
+        clh_lock() : _tail(queue_lock_detail::take_node()), _owner()
+        {
+            node_t* node = _tail.load(std::memory_order_relaxed);
+            node->state.store(node, std::memory_order_relaxed);
+        }
+        clh_lock(clh_lock const&) = delete;
+        clh_lock& operator=(clh_lock const&) = delete;
+
+        ~clh_lock()
+        {
+            queue_lock_detail::recycle(_tail.load(std::memory_order_relaxed));
+        }
+
+        void lock()
+        {
+            node_t*& spare = queue_lock_detail::spare_node();
+            node_t* node = spare;
+            node->state.store(nullptr, std::memory_order_relaxed);
+            node_t* pred = _tail.exchange(node, std::memory_order_acq_rel);
+            spare = queue_lock_detail::wait_for(pred);
+            _owner = node;
+        }
+
+        /// Never waits: returns false if the lock is held or the attempt
+        /// races with another thread.
+        bool try_lock()
+        {
+            node_t* pred = _tail.load(std::memory_order_acquire);
+            if (pred->state.load(std::memory_order_relaxed) != pred)
+                return false;
+            node_t*& spare = queue_lock_detail::spare_node();
+            node_t* node = spare;
+            node->state.store(nullptr, std::memory_order_relaxed);
+            if (!_tail.compare_exchange_strong(pred, node, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return false;
+            if (pred->state.load(std::memory_order_acquire) == pred)
+            {
+                spare = pred;
+                _owner = node;
+                return true;
+            }
+            // The node has been recycled and enqueued again since the check,
+            // so give up our place: leave the queue if no one has followed,
+            // otherwise let the successor wait on `pred` instead.
+            node_t* last = node;
+            if (_tail.compare_exchange_strong(last, pred, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return false;
+            node->state.store(pred, std::memory_order_release);
+            spare = queue_lock_detail::take_node();
+            return false;
+        }
+
+        void unlock() noexcept
+        {
+            _owner->state.store(_owner, std::memory_order_release);
+        }
+    };
+}
+
+#endif
\ No newline at end of file
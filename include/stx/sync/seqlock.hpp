@@ -0,0 +1,153 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_SEQLOCK_HPP_INCLUDED
+#define STX_SYNC_SEQLOCK_HPP_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <stx/sync/backoff.hpp>
+
+namespace stx
+{
+    /// A sequence counter, odd while a write is in progress. Readers take
+    /// a snapshot between `read_begin()` and `read_retry()`, and try again
+    /// if a write overlapped; they never write to shared memory.
+    ///
+    /// Writers must be serialized by other means, see `seqlock<T>` for a
+    /// self-contained variant. The protected data must be accessed with
+    /// (relaxed) atomics to avoid data races.
+    class seqcount
+    {
+        std::atomic<std::uint32_t> _seq;
+
+    public:
+        seqcount() noexcept : _seq(0) {}
+        seqcount(seqcount const&) = delete;
+        seqcount& operator=(seqcount const&) = delete;
+
+        /// Wait until no write is in progress and return the sequence.
+        std::uint32_t read_begin() const noexcept
+        {
+            std::uint32_t seq = _seq.load(std::memory_order_acquire);
+            while (seq & 1)
+            {
+                cpu_relax();
+                seq = _seq.load(std::memory_order_acquire);
+            }
+            return seq;
+        }
+
+        /// \return true if the data read since `read_begin()` may be torn.
+        bool read_retry(std::uint32_t seq) const noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return _seq.load(std::memory_order_relaxed) != seq;
+        }
+
+        void write_begin() noexcept
+        {
+            _seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        void write_end() noexcept
+        {
+            _seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        /// Like `write_begin()`, but waits for other writers using the
+        /// same method, so the odd count also serves as a spinlock.
+        void lock_write() noexcept
+        {
+            std::uint32_t seq = _seq.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if (seq & 1)
+                {
+                    cpu_relax();
+                    seq = _seq.load(std::memory_order_relaxed);
+                }
+                else if (_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_relaxed))
+                    break;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+    };
+
+    /// A value of trivially copyable `T` that one thread can update while
+    /// many read snapshots of it without writing to shared memory, e.g. a
+    /// quote read by many threads. Concurrent `store()`s are serialized.
+    ///
+    /// The value is kept as an array of words accessed with relaxed
+    /// atomics, so `load()` is free of data races even when it has to
+    /// retry.
+    template<class T>
+    class seqlock
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+        using word = std::uintptr_t;
+
+        static constexpr std::size_t words = (sizeof(T) + sizeof(word) - 1) / sizeof(word);
+
+        seqcount _seq;
+        std::atomic<word> _data[words];
+
+    public:
+
+        /// Only available if `T` is default constructible.
+        seqlock() noexcept : seqlock(T()) {}
+
+        explicit seqlock(T const& value) noexcept
+        {
+            word buf[words] = {};
+            std::memcpy(buf, &value, sizeof(T));
+            for (std::size_t i = 0; i != words; ++i)
+                _data[i].store(buf[i], std::memory_order_relaxed);
+        }
+
+        seqlock(seqlock const&) = delete;
+        seqlock& operator=(seqlock const&) = delete;
+
+        T load() const noexcept
+        {
+            word buf[words];
+            std::uint32_t seq;
+            do
+            {
+                seq = _seq.read_begin();
+                for (std::size_t i = 0; i != words; ++i)
+                    buf[i] = _data[i].load(std::memory_order_relaxed);
+            } while (_seq.read_retry(seq));
+            // Copying the bytes creates the object, so T need not be
+            // default constructible.
+            alignas(T) unsigned char storage[sizeof(T)];
+            std::memcpy(storage, buf, sizeof(T));
+#if defined(__cpp_lib_launder)
+            return *std::launder(reinterpret_cast<T*>(storage));
+#else
+            return *reinterpret_cast<T*>(storage);
+#endif
+        }
+
+        void store(T const& value) noexcept
+        {
+            word buf[words] = {};
+            std::memcpy(buf, &value, sizeof(T));
+            _seq.lock_write();
+            for (std::size_t i = 0; i != words; ++i)
+                _data[i].store(buf[i], std::memory_order_relaxed);
+            _seq.write_end();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_SYNC_SHARDED_SHARED_SPINLOCK_HPP_INCLUDED
+#define STX_SYNC_SHARDED_SHARED_SPINLOCK_HPP_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stx/sync/backoff.hpp>
+#include <stx/sync/spinlock.hpp>
+
+namespace stx { namespace sharded_shared_spinlock_detail
+{
+    struct alignas(64) slot
+    {
+        std::atomic<std::uint32_t> readers{0};
+    };
+
+    // Threads are numbered in the order they first take a shared lock, so
+    // that up to `Slots` threads get a slot of their own.
+    inline std::size_t thread_index() noexcept
+    {
+        static std::atomic<std::size_t> next(0);
+        static thread_local std::size_t const index = next.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+}}
+
+namespace stx
+{
+    /// A writer-preferring reader-writer spinlock for read-mostly data.
+    /// Readers only touch the counter of their own thread slot, each in a
+    /// separate cache line, so they do not contend with each other; in
+    /// exchange a writer has to scan all the `Slots` counters.
+    ///
+    /// A shared lock must be released by the thread that took it.
+    /// `Stats` is notified as in `basic_shared_spinlock`.
+    template<std::size_t Slots = 64, class Backoff = exponential_backoff<>, class Stats = null_lock_stats>
+    class basic_sharded_shared_spinlock : Stats
+    {
+        static_assert(Slots > 0, "no slot");
+
+        using slot = sharded_shared_spinlock_detail::slot;
+
+        // The writer flag and the readers' counters are used in a Dekker
+        // fashion: each side publishes itself before checking the other, so
+        // both need sequentially consistent operations.
+        alignas(64) std::atomic<bool> _writer;
+        slot _slots[Slots];
+
+    public:
+        basic_sharded_shared_spinlock() noexcept : _writer(false) {}
+
+        basic_sharded_shared_spinlock(basic_sharded_shared_spinlock const&) = delete;
+        basic_sharded_shared_spinlock& operator=(basic_sharded_shared_spinlock const&) = delete;
+
+        void lock()
+        {
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = _writer.exchange(true);
+            if (contended)
+            {
+                Backoff backoff;
+                do
+                {
+                    while (_writer.load(std::memory_order_relaxed))
+                    {
+                        backoff();
+                        ++spins;
+                    }
+                } while (_writer.exchange(true));
+            }
+            // New readers back off from now on; wait for the current ones.
+            for (auto& s : _slots)
+            {
+                if (s.readers.load())
+                {
+                    contended = true;
+                    Backoff backoff;
+                    do
+                    {
+                        backoff();
+                        ++spins;
+                    } while (s.readers.load());
+                }
+            }
+            this->on_lock(spins, start, contended);
+        }
+
+        void lock_shared()
+        {
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = false;
+            auto& s = my_slot();
+            while (!acquire_shared(s))
+            {
+                contended = true;
+                Backoff backoff;
+                while (_writer.load(std::memory_order_relaxed))
+                {
+                    backoff();
+                    ++spins;
+                }
+            }
+            this->on_lock_shared(spins, start, contended);
+        }
+
+        bool try_lock()
+        {
+            auto start = Stats::now();
+            if (_writer.load(std::memory_order_relaxed) || _writer.exchange(true))
+                return false;
+            for (auto& s : _slots)
+            {
+                if (s.readers.load())
+                {
+                    _writer.store(false, std::memory_order_release);
+                    return false;
+                }
+            }
+            this->on_lock(0, start, false);
+            return true;
+        }
+
+        bool try_lock_shared()
+        {
+            auto start = Stats::now();
+            if (_writer.load(std::memory_order_relaxed) || !acquire_shared(my_slot()))
+                return false;
+            this->on_lock_shared(0, start, false);
+            return true;
+        }
+
+        void unlock()
+        {
+            this->on_unlock();
+            _writer.store(false, std::memory_order_release);
+        }
+
+        void unlock_shared()
+        {
+            this->on_unlock_shared();
+            my_slot().readers.fetch_sub(1, std::memory_order_release);
+        }
+
+        Stats& stats() noexcept
+        {
+            return *this;
+        }
+
+        Stats const& stats() const noexcept
+        {
+            return *this;
+        }
+
+    private:
+
+        slot& my_slot() noexcept
+        {
+            return _slots[sharded_shared_spinlock_detail::thread_index() % Slots];
+        }
+
+        bool acquire_shared(slot& s)
+        {
+            s.readers.fetch_add(1);
+            if (!_writer.load())
+                return true;
+            s.readers.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+    };
+
+    using sharded_shared_spinlock = basic_sharded_shared_spinlock<>;
+}
+
+#endif
\ No newline at end of file
@@ -8,133 +8,263 @@
 #define STX_SYNC_SPINLOCK_HPP_INCLUDED
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stx/sync/backoff.hpp>
 
 namespace stx
 {
-    class spinlock
+    /// The default statistics policy of the spinlocks, which records nothing.
+    /// See `lock_stats` for the interface.
+    struct null_lock_stats
     {
-        std::atomic_flag _flag;
+        using stamp = int;
+
+        static stamp now() noexcept
+        {
+            return 0;
+        }
+
+        void on_lock(std::size_t /*spins*/, stamp /*start*/, bool /*contended*/) noexcept {}
+        void on_unlock() noexcept {}
+        void on_lock_shared(std::size_t /*spins*/, stamp /*start*/, bool /*contended*/) noexcept {}
+        void on_unlock_shared() noexcept {}
+    };
+
+    /// A test-and-test-and-set lock: waiters spin on a plain load, calling
+    /// a fresh `Backoff` object between attempts, and only retry the atomic
+    /// exchange once the lock looks free.
+    /// `Stats` is notified of each acquisition and release.
+    template<class Backoff = exponential_backoff<>, class Stats = null_lock_stats>
+    class basic_spinlock : Stats
+    {
+        std::atomic<bool> _locked;
 
     public:
-        spinlock() noexcept : _flag{ATOMIC_FLAG_INIT} {}
-        spinlock(spinlock const&) = delete;
-        spinlock& operator=(spinlock const&) = delete;
+        basic_spinlock() noexcept : _locked(false) {}
+        basic_spinlock(basic_spinlock const&) = delete;
+        basic_spinlock& operator=(basic_spinlock const&) = delete;
 
         void lock()
         {
-            while (_flag.test_and_set(std::memory_order_acquire));
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = _locked.exchange(true, std::memory_order_acquire);
+            if (contended)
+            {
+                Backoff backoff;
+                do
+                {
+                    while (_locked.load(std::memory_order_relaxed))
+                    {
+                        backoff();
+                        ++spins;
+                    }
+                } while (_locked.exchange(true, std::memory_order_acquire));
+            }
+            this->on_lock(spins, start, contended);
         }
 
         bool try_lock()
         {
-            return !_flag.test_and_set(std::memory_order_acquire);
+            auto start = Stats::now();
+            if (_locked.load(std::memory_order_relaxed) || _locked.exchange(true, std::memory_order_acquire))
+                return false;
+            this->on_lock(0, start, false);
+            return true;
         }
 
         void unlock()
         {
-            _flag.clear(std::memory_order_release);
+            this->on_unlock();
+            _locked.store(false, std::memory_order_release);
+        }
+
+        Stats& stats() noexcept
+        {
+            return *this;
+        }
+
+        Stats const& stats() const noexcept
+        {
+            return *this;
         }
     };
 
-    class shared_spinlock
+    using spinlock = basic_spinlock<>;
+
+    /// A writer-preferring reader-writer spinlock: a waiting writer sets the
+    /// `pending` bit, which keeps new readers out until it gets the lock.
+    template<class Backoff = exponential_backoff<>, class Stats = null_lock_stats>
+    class basic_shared_spinlock : Stats
     {
-        enum ownership : uint32_t { unique = 1, shared = 2 };
+        enum ownership : std::uint32_t { unique = 1, pending = 2, shared = 4 };
 
     public:
-        shared_spinlock() noexcept : _flags(0) {}
+        basic_shared_spinlock() noexcept : _flags(0) {}
 
-        shared_spinlock(shared_spinlock const&) = delete;
-        shared_spinlock& operator=(shared_spinlock const&) = delete;
+        basic_shared_spinlock(basic_shared_spinlock const&) = delete;
+        basic_shared_spinlock& operator=(basic_shared_spinlock const&) = delete;
 
         void lock()
         {
-            while (!try_lock());
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = false;
+            Backoff backoff;
+            while (!try_lock_or_announce())
+            {
+                contended = true;
+                backoff();
+                ++spins;
+            }
+            this->on_lock(spins, start, contended);
         }
 
         void lock_shared()
         {
-            while (!try_lock_shared());
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = false;
+            Backoff backoff;
+            while (!acquire_shared())
+            {
+                contended = true;
+                while (_flags.load(std::memory_order_relaxed) & (unique | pending))
+                {
+                    backoff();
+                    ++spins;
+                }
+            }
+            this->on_lock_shared(spins, start, contended);
         }
 
-#if 0
         template<class Rep, class Period>
         bool try_lock_for(std::chrono::duration<Rep,Period> const& duration)
         {
-            auto deadline = std::chrono::steady_clock::now() + duration;
-            while (!try_lock())
-            {
-                if (std::chrono::steady_clock::now() >= deadline)
-                    return false;
-            }
-            return true;
+            return try_lock_until(std::chrono::steady_clock::now() + duration);
         }
 
+        /// On timeout, the `pending` bit is withdrawn; other waiting writers
+        /// will set it again.
         template<class Clock, class Duration>
         bool try_lock_until(std::chrono::time_point<Clock,Duration> const& deadline)
         {
-            while (!try_lock())
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = false;
+            Backoff backoff;
+            while (!try_lock_or_announce())
             {
+                contended = true;
                 if (Clock::now() >= deadline)
+                {
+                    _flags.fetch_and(~pending, std::memory_order_relaxed);
                     return false;
+                }
+                backoff();
+                ++spins;
             }
+            this->on_lock(spins, start, contended);
             return true;
         }
 
         template<class Rep, class Period>
         bool try_lock_shared_for(std::chrono::duration<Rep,Period> const& duration)
         {
-            auto deadline = std::chrono::steady_clock::now() + duration;
-            while (!try_lock_shared())
-            {
-                if (std::chrono::steady_clock::now() >= deadline)
-                    return false;
-            }
-            return true;
+            return try_lock_shared_until(std::chrono::steady_clock::now() + duration);
         }
 
         template<class Clock, class Duration>
         bool try_lock_shared_until(std::chrono::time_point<Clock,Duration> const& deadline)
         {
-            while (!try_lock_shared())
+            auto start = Stats::now();
+            std::size_t spins = 0;
+            bool contended = false;
+            Backoff backoff;
+            while (!acquire_shared())
             {
+                contended = true;
                 if (Clock::now() >= deadline)
                     return false;
+                backoff();
+                ++spins;
             }
+            this->on_lock_shared(spins, start, contended);
             return true;
         }
-#endif
+
         void unlock()
         {
+            this->on_unlock();
             _flags.fetch_and(~unique, std::memory_order_release);
         }
 
         void unlock_shared()
         {
+            this->on_unlock_shared();
             _flags.fetch_sub(shared, std::memory_order_release);
         }
 
-
         bool try_lock()
         {
-            std::uint32_t expect = 0;
-            return _flags.compare_exchange_strong(expect, unique, std::memory_order_acq_rel);
+            auto start = Stats::now();
+            std::uint32_t value = _flags.load(std::memory_order_relaxed);
+            if ((value & ~pending) ||
+                !_flags.compare_exchange_strong(value, unique, std::memory_order_acquire, std::memory_order_relaxed))
+                return false;
+            this->on_lock(0, start, false);
+            return true;
         }
 
         bool try_lock_shared()
         {
-            std::uint32_t value = _flags.fetch_add(shared, std::memory_order_acquire);
-            if (value & unique)
-            {
-                _flags.fetch_sub(shared, std::memory_order_release);
+            auto start = Stats::now();
+            if (!acquire_shared())
                 return false;
-            }
+            this->on_lock_shared(0, start, false);
             return true;
         }
 
+        Stats& stats() noexcept
+        {
+            return *this;
+        }
+
+        Stats const& stats() const noexcept
+        {
+            return *this;
+        }
+
     private:
 
+        bool acquire_shared()
+        {
+            std::uint32_t value = _flags.load(std::memory_order_relaxed);
+            while (!(value & (unique | pending)))
+            {
+                if (_flags.compare_exchange_weak(value, value + shared, std::memory_order_acquire, std::memory_order_relaxed))
+                    return true;
+            }
+            return false;
+        }
+
+        // Take the lock if free, otherwise make sure `pending` is set.
+        bool try_lock_or_announce()
+        {
+            std::uint32_t value = _flags.load(std::memory_order_relaxed);
+            if (!(value & ~pending))
+                return _flags.compare_exchange_strong(value, unique, std::memory_order_acquire, std::memory_order_relaxed);
+            if (!(value & pending))
+                _flags.fetch_or(pending, std::memory_order_relaxed);
+            return false;
+        }
+
         std::atomic<std::uint32_t> _flags;
     };
+
+    using shared_spinlock = basic_shared_spinlock<>;
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_UTILITY_PREFETCH_HPP_INCLUDED
+#define STX_UTILITY_PREFETCH_HPP_INCLUDED
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+namespace stx
+{
+    /// Hint the CPU to bring the cache line holding `p` into all levels of
+    /// the cache for reading. It never faults, even on an invalid address.
+    inline void prefetch(void const* p) noexcept
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(p);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_prefetch(static_cast<char const*>(p), _MM_HINT_T0);
+#else
+        (void)p;
+#endif
+    }
+
+    /// Like `prefetch`, with the intent to write.
+    inline void prefetch_write(void* p) noexcept
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(p, 1);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _m_prefetchw(p);
+#else
+        (void)p;
+#endif
+    }
+}
+
+#endif
\ No newline at end of file
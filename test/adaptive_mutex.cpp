@@ -0,0 +1,146 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/adaptive_mutex.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    static_assert(sizeof(stx::adaptive_mutex) == 4, "one word per mutex");
+
+    void test_basic()
+    {
+        stx::adaptive_mutex m;
+        STX_CHECK(m.spin_budget() == 0);
+        STX_CHECK(m.try_lock());
+        STX_CHECK(!m.try_lock());
+        m.unlock();
+        m.lock();
+        m.unlock();
+        STX_CHECK(m.try_lock());
+        m.unlock();
+    }
+
+    // Waiters that outlast their spin budget block, and are woken by unlock.
+    void test_blocking()
+    {
+        stx::adaptive_mutex m;
+        m.lock();
+        std::atomic<int> passed(0);
+        std::vector<std::thread> pool;
+        for (int i = 0; i != 4; ++i)
+        {
+            pool.emplace_back([&]
+            {
+                m.lock();
+                ++passed;
+                m.unlock();
+            });
+        }
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(passed == 0);
+        m.unlock();
+        for (std::thread& t : pool)
+            t.join();
+        STX_CHECK(passed == 4);
+    }
+
+    // Acquisitions that wait out the whole spin raise the budget, which
+    // never exceeds `max_spins`.
+    void test_budget()
+    {
+        stx::adaptive_mutex m;
+        for (int i = 0; i != 20; ++i)
+        {
+            m.lock();
+            std::atomic<bool> started(false);
+            std::thread waiter([&]
+            {
+                started = true;
+                m.lock();
+                m.unlock();
+            });
+            while (!started)
+                std::this_thread::yield();
+            std::this_thread::sleep_for(1ms);
+            m.unlock();
+            waiter.join();
+        }
+        STX_CHECK(m.spin_budget() > 0);
+        STX_CHECK(m.spin_budget() <= stx::adaptive_mutex::max_spins);
+        // The budget bits do not leak into the lock state.
+        STX_CHECK(m.try_lock());
+        STX_CHECK(!m.try_lock());
+        m.unlock();
+    }
+
+    void test_exclusion()
+    {
+        stx::adaptive_mutex m;
+        long counter = 0;
+        std::vector<std::thread> pool;
+        for (int t = 0; t != 4; ++t)
+        {
+            pool.emplace_back([&, t]
+            {
+                for (int i = 0; i != 20000; ++i)
+                {
+                    std::lock_guard<stx::adaptive_mutex> guard(m);
+                    ++counter;
+                    // Now and then, hold long enough to make others block.
+                    if (i % 2000 == t)
+                        std::this_thread::sleep_for(100us);
+                }
+            });
+        }
+        for (std::thread& t : pool)
+            t.join();
+        STX_CHECK(counter == 80000);
+        STX_CHECK(m.spin_budget() <= stx::adaptive_mutex::max_spins);
+    }
+
+    // An array of mutexes, as the single word allows.
+    void test_array()
+    {
+        std::vector<stx::adaptive_mutex> locks(64);
+        std::vector<long> counters(64);
+        std::vector<std::thread> pool;
+        for (int t = 0; t != 4; ++t)
+        {
+            pool.emplace_back([&, t]
+            {
+                for (int i = 0; i != 20000; ++i)
+                {
+                    std::size_t k = std::size_t(i * 7 + t) % 64;
+                    std::lock_guard<stx::adaptive_mutex> guard(locks[k]);
+                    ++counters[k];
+                }
+            });
+        }
+        for (std::thread& t : pool)
+            t.join();
+        long total = 0;
+        for (long c : counters)
+            total += c;
+        STX_CHECK(total == 80000);
+    }
+}
+
+int main()
+{
+    test_basic();
+    test_blocking();
+    test_budget();
+    test_exclusion();
+    test_array();
+}
\ No newline at end of file
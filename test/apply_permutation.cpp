@@ -0,0 +1,268 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/algorithm/apply_permutation.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    struct wide
+    {
+        std::uint64_t w[8];
+
+        explicit wide(std::size_t i = 0) noexcept
+        {
+            for (std::uint64_t& x : w)
+                x = i++;
+        }
+
+        bool operator==(wide const& other) const noexcept
+        {
+            return std::equal(w, w + 8, other.w);
+        }
+    };
+
+    template<class T>
+    T make(std::size_t i);
+
+    template<>
+    std::int64_t make<std::int64_t>(std::size_t i)
+    {
+        return std::int64_t(i * 7 - 3);
+    }
+
+    template<>
+    wide make<wide>(std::size_t i)
+    {
+        return wide(i);
+    }
+
+    template<>
+    std::string make<std::string>(std::size_t i)
+    {
+        // Long enough to live on the heap.
+        return std::to_string(i) + std::string(20, 'x');
+    }
+
+    std::vector<std::uint32_t> random_permutation(std::size_t n, std::mt19937_64& rng)
+    {
+        std::vector<std::uint32_t> idx(n);
+        std::iota(idx.begin(), idx.end(), 0u);
+        std::shuffle(idx.begin(), idx.end(), rng);
+        return idx;
+    }
+
+    template<class T>
+    std::vector<T> values(std::size_t n)
+    {
+        std::vector<T> v;
+        v.reserve(n);
+        for (std::size_t i = 0; i != n; ++i)
+            v.push_back(make<T>(i));
+        return v;
+    }
+
+    // `v[i]` is the value formerly at `idx[i]`.
+    template<class T>
+    bool permuted(std::vector<T> const& v, std::vector<std::uint32_t> const& idx)
+    {
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            if (!(v[i] == make<T>(idx[i])))
+                return false;
+        }
+        return true;
+    }
+
+    bool identity(std::vector<std::uint32_t> const& idx)
+    {
+        for (std::size_t i = 0; i != idx.size(); ++i)
+        {
+            if (idx[i] != i)
+                return false;
+        }
+        return true;
+    }
+
+    // The largest is split among up to two threads.
+    std::vector<std::size_t> const sizes{0, 1, 2, 3, 17, 1000, 140001};
+
+    template<class T>
+    void test_sequential()
+    {
+        std::mt19937_64 rng(1);
+        for (std::size_t n : sizes)
+        {
+            auto v = values<T>(n);
+            auto const perm = random_permutation(n, rng);
+            auto idx = perm;
+            stx::apply_permutation(v.begin(), v.end(), idx.begin());
+            STX_CHECK(permuted(v, perm));
+            STX_CHECK(identity(idx));
+        }
+    }
+
+    // Small ranges fall back to the sequential version, large ones are
+    // split among the threads, including uneven slices.
+    template<class T>
+    void test_parallel()
+    {
+        std::mt19937_64 rng(2);
+        for (std::size_t n : sizes)
+        {
+            for (unsigned threads : {0u, 1u, 2u, 3u, 4u, 7u})
+            {
+                auto v = values<T>(n);
+                auto const perm = random_permutation(n, rng);
+                auto idx = perm;
+                stx::apply_permutation(v.begin(), v.end(), idx.begin(), threads);
+                STX_CHECK(permuted(v, perm));
+                STX_CHECK(identity(idx));
+            }
+        }
+    }
+
+    template<class T>
+    void test_out_of_place()
+    {
+        std::mt19937_64 rng(3);
+        for (std::size_t n : sizes)
+        {
+            auto v = values<T>(n);
+            auto const idx = random_permutation(n, rng);
+            std::vector<T> out(n);
+            auto end = stx::apply_permutation_to(v.begin(), v.end(), idx.begin(), out.begin());
+            STX_CHECK(end == out.end());
+            STX_CHECK(permuted(out, idx));
+
+            // To an output iterator; the indices are left alone.
+            v = values<T>(n);
+            std::vector<T> appended;
+            stx::apply_permutation_to(v.begin(), v.end(), idx.cbegin(), std::back_inserter(appended));
+            STX_CHECK(permuted(appended, idx));
+        }
+    }
+
+    // The indices are left as given, and may be applied again.
+    template<class T>
+    void test_preserve_index()
+    {
+        std::mt19937_64 rng(4);
+        for (std::size_t n : sizes)
+        {
+            auto v = values<T>(n);
+            auto const perm = random_permutation(n, rng);
+            auto idx = perm;
+            stx::apply_permutation(stx::preserve_index, v.begin(), v.end(), idx.begin());
+            STX_CHECK(permuted(v, perm));
+            STX_CHECK(idx == perm);
+
+            // Twice is the square of the permutation.
+            stx::apply_permutation(stx::preserve_index, v.begin(), v.end(), idx.begin());
+            for (std::size_t i = 0; i != n; ++i)
+                STX_CHECK(v[i] == make<T>(perm[perm[i]]));
+        }
+    }
+
+    // Every size up to a few blocks, with partial last blocks.
+    template<class T>
+    void test_blocked()
+    {
+        std::mt19937_64 rng(6);
+        for (std::size_t n : sizes)
+        {
+            for (bool adaptive : {false, true})
+            {
+                auto v = values<T>(n);
+                auto const perm = random_permutation(n, rng);
+                auto idx = perm;
+                if (adaptive)
+                    stx::apply_permutation(stx::cache_adaptive, v.begin(), v.end(), idx.begin());
+                else
+                    stx::apply_permutation(stx::cache_blocked, v.begin(), v.end(), idx.begin());
+                STX_CHECK(permuted(v, perm));
+                STX_CHECK(identity(idx));
+            }
+        }
+    }
+
+    template<class T>
+    void test_type()
+    {
+        test_sequential<T>();
+        test_parallel<T>();
+        test_out_of_place<T>();
+        test_preserve_index<T>();
+        test_blocked<T>();
+    }
+
+    // Columns of different types move together, with and without
+    // resetting the indices.
+    void test_columns()
+    {
+        std::mt19937_64 rng(5);
+        for (std::size_t n : sizes)
+        {
+            for (bool preserve : {false, true})
+            {
+                auto a = values<std::int64_t>(n);
+                auto b = values<wide>(n);
+                auto c = values<std::string>(n);
+                auto const perm = random_permutation(n, rng);
+                auto idx = perm;
+                if (preserve)
+                    stx::apply_permutation_columns(stx::preserve_index, idx.begin(), idx.end(), a.begin(), b.begin(), c.begin());
+                else
+                    stx::apply_permutation_columns(idx.begin(), idx.end(), a.begin(), b.begin(), c.begin());
+                STX_CHECK(permuted(a, perm));
+                STX_CHECK(permuted(b, perm));
+                STX_CHECK(permuted(c, perm));
+                STX_CHECK(preserve? idx == perm : identity(idx));
+            }
+        }
+
+        // A single column, and a permutation of fixed points and 2-cycles.
+        std::vector<int> col{10, 11, 12, 13, 14};
+        std::vector<int> idx{1, 0, 2, 4, 3};
+        stx::apply_permutation_columns(idx.begin(), idx.end(), col.begin());
+        STX_CHECK((col == std::vector<int>{11, 10, 12, 14, 13}));
+        STX_CHECK((idx == std::vector<int>{0, 1, 2, 3, 4}));
+
+        // Sorting by an order kept for later.
+        std::vector<int> keys{30, 10, 20};
+        std::vector<int> order{1, 2, 0};
+        stx::apply_permutation_columns(stx::preserve_index, order.begin(), order.end(), keys.begin());
+        STX_CHECK((keys == std::vector<int>{10, 20, 30}));
+        STX_CHECK((order == std::vector<int>{1, 2, 0}));
+    }
+}
+
+int main()
+{
+    test_type<std::int64_t>();
+    test_type<wide>();
+    test_type<std::string>();
+    test_columns();
+
+    // Large enough for cache_adaptive to take the blocked path, with a
+    // signed index of another width.
+    std::mt19937_64 rng(7);
+    std::size_t const n = (std::size_t(1) << 19) + 1000;
+    auto v = values<std::int64_t>(n);
+    auto const perm = random_permutation(n, rng);
+    std::vector<std::int64_t> idx(perm.begin(), perm.end());
+    stx::apply_permutation(stx::cache_adaptive, v.begin(), v.end(), idx.begin());
+    STX_CHECK(permuted(v, perm));
+    for (std::size_t i = 0; i != n; ++i)
+        STX_CHECK(idx[i] == std::int64_t(i));
+}
@@ -0,0 +1,162 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/async_event.hpp>
+#include "check.hpp"
+
+#if defined(STX_SYNC_HAS_COROUTINE)
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <exception>
+
+namespace
+{
+    // A coroutine that starts eagerly and frees itself when done.
+    struct task
+    {
+        struct promise_type
+        {
+            task get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    task record(stx::async_event& ev, std::vector<int>& log, int id)
+    {
+        log.push_back(-id);
+        co_await ev;
+        log.push_back(id);
+    }
+
+    task twice(stx::async_event& a, stx::async_event& b, int& stage)
+    {
+        co_await a;
+        stage = 1;
+        co_await b;
+        stage = 2;
+    }
+
+    void test_ready()
+    {
+        stx::async_event ev(true);
+        STX_CHECK(ev.is_set());
+        std::vector<int> log;
+        record(ev, log, 1);
+        STX_CHECK((log == std::vector<int>{-1, 1}));
+        ev.set();
+        STX_CHECK(ev.is_set());
+    }
+
+    void test_fifo()
+    {
+        stx::async_event ev;
+        STX_CHECK(!ev.is_set());
+        std::vector<int> log;
+        for (int id = 1; id <= 3; ++id)
+            record(ev, log, id);
+        STX_CHECK((log == std::vector<int>{-1, -2, -3}));
+        ev.set();
+        STX_CHECK((log == std::vector<int>{-1, -2, -3, 1, 2, 3}));
+        // Once set, awaiting does not suspend.
+        record(ev, log, 4);
+        STX_CHECK(log.back() == 4);
+    }
+
+    void test_reset()
+    {
+        stx::async_event a, b;
+        int stage = 0;
+        twice(a, b, stage);
+        STX_CHECK(stage == 0);
+        a.set();
+        STX_CHECK(stage == 1);
+        b.set();
+        STX_CHECK(stage == 2);
+
+        a.reset();
+        STX_CHECK(!a.is_set());
+        a.reset();
+        std::vector<int> log;
+        record(a, log, 1);
+        STX_CHECK(log.size() == 1);
+        a.set();
+        STX_CHECK(log.size() == 2);
+    }
+
+    void test_executor()
+    {
+        stx::async_event ev;
+        std::vector<int> log;
+        record(ev, log, 1);
+        record(ev, log, 2);
+        std::vector<std::coroutine_handle<>> queued;
+        ev.set([&](std::coroutine_handle<> h)
+        {
+            queued.push_back(h);
+        });
+        // Nothing runs until the executor resumes it.
+        STX_CHECK(log.size() == 2);
+        STX_CHECK(queued.size() == 2);
+        for (std::coroutine_handle<> h : queued)
+            h.resume();
+        STX_CHECK((log == std::vector<int>{-1, -2, 1, 2}));
+        // A second set() hands nothing over.
+        ev.set([&](std::coroutine_handle<>)
+        {
+            STX_CHECK(false);
+        });
+    }
+
+    task count(stx::async_event& ev, std::atomic<int>& resumed)
+    {
+        co_await ev;
+        ++resumed;
+    }
+
+    // Coroutines suspending on several threads while another sets the
+    // event: each must be resumed exactly once.
+    void test_threads()
+    {
+        for (int round = 0; round != 200; ++round)
+        {
+            stx::async_event ev;
+            std::atomic<int> resumed(0);
+            std::vector<std::thread> pool;
+            for (int t = 0; t != 4; ++t)
+            {
+                pool.emplace_back([&]
+                {
+                    for (int i = 0; i != 25; ++i)
+                        count(ev, resumed);
+                });
+            }
+            std::thread setter([&]
+            {
+                ev.set();
+            });
+            setter.join();
+            for (std::thread& t : pool)
+                t.join();
+            STX_CHECK(resumed == 100);
+        }
+    }
+}
+
+int main()
+{
+    test_ready();
+    test_fifo();
+    test_reset();
+    test_executor();
+    test_threads();
+}
+#else
+int main() {}
+#endif
\ No newline at end of file
@@ -0,0 +1,203 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/algorithm/binary_search.hpp>
+#include <stx/utility/array_view.hpp>
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    using stx::binary_search_detail::is_fast;
+
+    static_assert(is_fast<int const*, int, std::less<>>::value, "");
+    static_assert(is_fast<std::vector<int>::iterator, int, std::less<>>::value, "");
+    static_assert(is_fast<std::vector<double>::const_iterator, double, std::less<double>>::value, "");
+    static_assert(is_fast<std::string::const_iterator, char, std::less<>>::value, "");
+    static_assert(is_fast<std::array<float, 4>::iterator, float, std::less<>>::value, "");
+    static_assert(is_fast<stx::array_view<std::int64_t>::iterator, std::int64_t, std::less<>>::value, "");
+    static_assert(!is_fast<std::deque<int>::iterator, int, std::less<>>::value, "");
+    static_assert(!is_fast<std::vector<int>::iterator, long, std::less<>>::value, "");
+    static_assert(!is_fast<std::vector<int>::iterator, int, std::greater<>>::value, "");
+    static_assert(!is_fast<std::vector<bool>::iterator, bool, std::less<>>::value, "");
+    static_assert(!is_fast<std::vector<std::string>::iterator, std::string, std::less<>>::value, "");
+
+    template<class T>
+    T draw(std::mt19937_64& rng, T lo, T hi)
+    {
+        using dist = typename std::conditional<std::is_floating_point<T>::value,
+            std::uniform_real_distribution<T>, std::uniform_int_distribution<T>>::type;
+        return dist(lo, hi)(rng);
+    }
+
+    // Search sorted vectors of every length up to a few windows, plus a
+    // large one, for present and absent keys. Duplicates are common, and
+    // the fast path must find the leftmost.
+    template<class T, class Range>
+    void check_range(Range const& r, T val)
+    {
+        auto first = r.begin(), last = r.end();
+        auto it = stx::binary_search(first, last, val);
+        auto lb = std::lower_bound(first, last, val);
+        if (lb == last || val < *lb)
+            STX_CHECK(it == last);
+        else
+            STX_CHECK(it == lb);
+    }
+
+    template<class T>
+    void test_type(T lo, T hi)
+    {
+        std::mt19937_64 rng(sizeof(T) * 7 + std::is_signed<T>::value);
+        std::size_t const w = stx::binary_search_detail::window<T>();
+        std::vector<std::size_t> sizes;
+        for (std::size_t n = 0; n <= 3 * w + 2; ++n)
+            sizes.push_back(n);
+        sizes.push_back(1000);
+        sizes.push_back(4097);
+        for (std::size_t n : sizes)
+        {
+            // Narrow ranges give duplicates, wide ones reach the extremes.
+            for (bool narrow : {true, false})
+            {
+                std::vector<T> v(n);
+                for (T& x : v)
+                    x = narrow? draw<T>(rng, T(0), T(n / 2 + 1)) : draw<T>(rng, lo, hi);
+                std::sort(v.begin(), v.end());
+                for (int k = 0; k != 20; ++k)
+                {
+                    T val = n && k % 2? v[std::size_t(rng() % n)] : narrow? draw<T>(rng, T(0), T(n / 2 + 2)) : draw<T>(rng, lo, hi);
+                    check_range(v, val);
+                    std::vector<T> const& cv = v;
+                    check_range(cv, val);
+                    check_range(stx::array_view<T const>(v.data(), v.size()), val);
+                }
+                check_range(v, lo);
+                check_range(v, hi);
+            }
+        }
+    }
+
+    // Non-contiguous iterators and other comparators take the generic
+    // path, which finds any of the equal elements.
+    void test_generic()
+    {
+        std::deque<int> d;
+        for (int i = 0; i != 500; ++i)
+            d.push_back(i / 3 * 2);
+        for (int val = -2; val != 340; ++val)
+        {
+            auto it = stx::binary_search(d.begin(), d.end(), val);
+            if (val >= 0 && val % 2 == 0 && val <= d.back())
+                STX_CHECK(it != d.end() && *it == val);
+            else
+                STX_CHECK(it == d.end());
+        }
+
+        std::vector<int> desc(d.rbegin(), d.rend());
+        auto it = stx::binary_search(desc.begin(), desc.end(), 10, std::greater<>{});
+        STX_CHECK(it != desc.end() && *it == 10);
+        STX_CHECK(stx::binary_search(desc.begin(), desc.end(), 11, std::greater<>{}) == desc.end());
+
+        std::vector<std::string> words{"apple", "kiwi", "pear", "plum"};
+        STX_CHECK(stx::binary_search(words.begin(), words.end(), std::string("pear")) == words.begin() + 2);
+        STX_CHECK(stx::binary_search(words.begin(), words.end(), std::string("fig")) == words.end());
+
+        std::string s = "aaabbbcccddd";
+        STX_CHECK(stx::binary_search(s.begin(), s.end(), 'c') == s.begin() + 6);
+        STX_CHECK(stx::binary_search(s.cbegin(), s.cend(), 'e') == s.cend());
+
+        std::array<double, 5> a{{-1.5, 0.0, 0.0, 2.25, 8.0}};
+        STX_CHECK(stx::binary_search(a.begin(), a.end(), 0.0) == a.begin() + 1);
+        STX_CHECK(stx::binary_search(a.begin(), a.begin(), 0.0) == a.begin());
+    }
+
+    // Each result is the leftmost equivalent element, as from
+    // lower_bound, or `last`.
+    template<std::size_t Group, class RandIt, class KeyIt, class Cmp>
+    void check_batch(RandIt first, RandIt last, KeyIt keys_first, KeyIt keys_last, Cmp cmp)
+    {
+        std::vector<RandIt> found;
+        stx::binary_search_batch<Group>(first, last, keys_first, keys_last, std::back_inserter(found), cmp);
+        STX_CHECK(found.size() == std::size_t(std::distance(keys_first, keys_last)));
+        auto it = found.begin();
+        for (; keys_first != keys_last; ++keys_first, ++it)
+        {
+            auto lb = std::lower_bound(first, last, *keys_first, cmp);
+            STX_CHECK(*it == (lb == last || cmp(*keys_first, *lb)? last : lb));
+        }
+    }
+
+    template<std::size_t Group>
+    void test_batch_group()
+    {
+        std::mt19937_64 rng(Group);
+        for (std::size_t n : {0u, 1u, 2u, 7u, 16u, 17u, 100u, 4097u})
+        {
+            std::vector<int> v(n);
+            for (int& x : v)
+                x = int(rng() % (n + 1));
+            std::sort(v.begin(), v.end());
+            for (std::size_t k : {std::size_t(0), std::size_t(1), Group - 1, Group, Group + 1, 3 * Group + 5})
+            {
+                std::vector<int> keys(k);
+                for (int& x : keys)
+                    x = int(rng() % (n + 3)) - 1;
+                check_batch<Group>(v.begin(), v.end(), keys.begin(), keys.end(), std::less<>{});
+                std::forward_list<int> list(keys.begin(), keys.end());
+                check_batch<Group>(v.cbegin(), v.cend(), list.begin(), list.end(), std::less<>{});
+                std::deque<int> d(v.rbegin(), v.rend());
+                check_batch<Group>(d.begin(), d.end(), keys.begin(), keys.end(), std::greater<>{});
+            }
+        }
+    }
+
+    void test_batch()
+    {
+        test_batch_group<1>();
+        test_batch_group<3>();
+        test_batch_group<16>();
+        test_batch_group<64>();
+
+        // Agrees with binary_search, and returns the advanced output.
+        std::vector<double> v{-2.5, 0.0, 0.0, 1.0, 4.0};
+        std::vector<double> keys{0.0, 4.0, 3.0, -2.5, 9.0};
+        std::vector<std::vector<double>::iterator> found(keys.size() + 1, v.begin());
+        auto out = stx::binary_search_batch(v.begin(), v.end(), keys.begin(), keys.end(), found.begin());
+        STX_CHECK(out == found.begin() + 5);
+        for (std::size_t i = 0; i != keys.size(); ++i)
+            STX_CHECK(found[i] == stx::binary_search(v.begin(), v.end(), keys[i]));
+        STX_CHECK(stx::binary_search_batch(v.begin(), v.end(), keys.begin(), keys.begin(), found.begin()) == found.begin());
+
+        std::vector<std::string> words{"apple", "kiwi", "pear", "plum"};
+        std::string const wanted[] = {"plum", "fig", "apple"};
+        std::vector<std::string>::iterator res[3];
+        stx::binary_search_batch<2>(words.begin(), words.end(), wanted, wanted + 3, res);
+        STX_CHECK(res[0] == words.begin() + 3 && res[1] == words.end() && res[2] == words.begin());
+    }
+}
+
+int main()
+{
+    test_type<std::int32_t>(std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max());
+    test_type<std::uint32_t>(0, std::numeric_limits<std::uint32_t>::max());
+    test_type<std::int64_t>(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max());
+    test_type<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max());
+    test_type<float>(-1e30f, 1e30f);
+    test_type<double>(-1e300, 1e300);
+    test_type<short>(std::numeric_limits<short>::min(), std::numeric_limits<short>::max());
+    test_generic();
+    test_batch();
+}
\ No newline at end of file
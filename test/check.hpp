@@ -0,0 +1,25 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#ifndef STX_TEST_CHECK_HPP_INCLUDED
+#define STX_TEST_CHECK_HPP_INCLUDED
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace stx_test
+{
+    [[noreturn]] inline void fail(char const* expr, char const* file, int line)
+    {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+        std::abort();
+    }
+}
+
+/// Like `assert`, but also checked with `NDEBUG`.
+#define STX_CHECK(...) ((__VA_ARGS__)? void() : ::stx_test::fail(#__VA_ARGS__, __FILE__, __LINE__))
+
+#endif
\ No newline at end of file
@@ -0,0 +1,309 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/event.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    using namespace std::chrono_literals;
+    using std::chrono::steady_clock;
+
+    void test_futex()
+    {
+        std::atomic<std::uint32_t> word(0);
+        // A stale expected value returns at once.
+        stx::futex_wait(word, 1);
+        auto start = steady_clock::now();
+        STX_CHECK(!stx::futex_wait_for(word, 0, 10ms));
+        STX_CHECK(steady_clock::now() - start >= 10ms);
+        STX_CHECK(!stx::futex_wait_for(word, 0, 0ms));
+
+        std::thread waker([&]
+        {
+            std::this_thread::sleep_for(5ms);
+            word.store(1);
+            stx::futex_wake_all(word);
+        });
+        while (word.load() == 0)
+            stx::futex_wait(word, 0);
+        waker.join();
+    }
+
+    void test_event()
+    {
+        stx::event ev;
+        STX_CHECK(!ev.try_wait());
+        ev.set();
+        STX_CHECK(ev.try_wait());
+        ev.wait();
+        ev.set();
+        STX_CHECK(ev.try_wait());
+    }
+
+    void test_many_waiters()
+    {
+        stx::event ev;
+        std::atomic<int> woken(0);
+        std::vector<std::thread> pool;
+        for (int i = 0; i != 8; ++i)
+        {
+            pool.emplace_back([&]
+            {
+                ev.wait();
+                ++woken;
+            });
+        }
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(woken == 0);
+        ev.set();
+        for (std::thread& t : pool)
+            t.join();
+        STX_CHECK(woken == 8);
+    }
+
+    // Race set() against a waiter going to sleep, to catch lost wakeups.
+    void test_race()
+    {
+        for (int i = 0; i != 2000; ++i)
+        {
+            std::unique_ptr<stx::event> ev(new stx::event);
+            std::thread waiter([&]
+            {
+                ev->wait();
+            });
+            if (i & 1)
+                std::this_thread::yield();
+            ev->set();
+            waiter.join();
+        }
+    }
+
+    void test_reset()
+    {
+        stx::event ev;
+        ev.set();
+        ev.reset();
+        STX_CHECK(!ev.try_wait());
+        std::atomic<bool> passed(false);
+        std::thread waiter([&]
+        {
+            ev.wait();
+            passed = true;
+        });
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(!passed);
+        ev.set();
+        waiter.join();
+        STX_CHECK(passed);
+        ev.reset();
+        ev.reset();
+        STX_CHECK(!ev.try_wait());
+    }
+
+    void test_wait_any()
+    {
+        stx::event a, b, c;
+        b.set();
+        STX_CHECK(stx::wait_any(a, b, c) == 1);
+        b.reset();
+
+        auto start = steady_clock::now();
+        STX_CHECK(stx::wait_any_until(start + 10ms, a, b, c) == 3);
+        STX_CHECK(steady_clock::now() - start >= 10ms);
+
+        std::thread setter([&]
+        {
+            std::this_thread::sleep_for(5ms);
+            c.set();
+        });
+        STX_CHECK(stx::wait_any(a, b, c) == 2);
+        setter.join();
+        STX_CHECK(stx::wait_any_until(steady_clock::now() + 1s, a, b, c) == 2);
+    }
+
+    void test_wait_all()
+    {
+        stx::event a, b;
+        a.set();
+        STX_CHECK(!stx::wait_all_until(steady_clock::now() + 10ms, a, b));
+        b.set();
+        stx::wait_all(a, b);
+        STX_CHECK(stx::wait_all_until(steady_clock::now(), a, b));
+
+        a.reset();
+        b.reset();
+        std::atomic<bool> passed(false);
+        std::thread waiter([&]
+        {
+            stx::wait_all(a, b);
+            passed = true;
+        });
+        a.set();
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(!passed);
+        b.set();
+        waiter.join();
+        STX_CHECK(passed);
+    }
+
+    // Multi-event waiters on events sharing a bucket must only be woken by
+    // their own events, and never miss a wakeup.
+    void test_multi_race()
+    {
+        std::vector<stx::event> events(16);
+        for (int i = 0; i != 500; ++i)
+        {
+            std::size_t k = std::size_t(i) % 8 * 2;
+            stx::event& x = events[k];
+            stx::event& y = events[k + 1];
+            std::atomic<std::size_t> got(0);
+            std::thread any([&]
+            {
+                got = stx::wait_any(x, y);
+            });
+            std::thread all([&]
+            {
+                stx::wait_all(x, y);
+            });
+            if (i & 1)
+                std::this_thread::yield();
+            (i & 2? x : y).set();
+            any.join();
+            STX_CHECK(got == (i & 2? 0u : 1u));
+            (i & 2? y : x).set();
+            all.join();
+            x.reset();
+            y.reset();
+        }
+    }
+
+    // Wait until `n` reaches `expected`, or time out.
+    bool reaches(std::atomic<int> const& n, int expected)
+    {
+        auto deadline = steady_clock::now() + 10s;
+        while (n.load() != expected)
+        {
+            if (steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+
+    void test_auto_reset()
+    {
+        stx::auto_reset_event initially(true);
+        initially.wait();
+
+        stx::auto_reset_event ev;
+        std::atomic<int> passed(0);
+        std::vector<std::thread> pool;
+        for (int i = 0; i != 4; ++i)
+        {
+            pool.emplace_back([&]
+            {
+                ev.wait();
+                ++passed;
+            });
+        }
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(passed == 0);
+        // Each set() lets exactly one waiter through.
+        for (int i = 1; i <= 4; ++i)
+        {
+            ev.set();
+            STX_CHECK(reaches(passed, i));
+            std::this_thread::sleep_for(5ms);
+            STX_CHECK(passed == i);
+        }
+        for (std::thread& t : pool)
+            t.join();
+
+        // Setting a set event has no effect; reset() takes the signal back.
+        ev.set();
+        ev.set();
+        ev.wait();
+        std::thread late([&]
+        {
+            ev.wait();
+            ++passed;
+        });
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(passed == 4);
+        ev.set();
+        late.join();
+        STX_CHECK(passed == 5);
+        ev.set();
+        ev.reset();
+        ev.set();
+        ev.wait();
+    }
+
+    void test_countdown()
+    {
+        stx::countdown_event done(0);
+        done.wait();
+
+        int const tasks = 6;
+        stx::countdown_event latch(tasks);
+        std::atomic<int> finished(0);
+        std::atomic<bool> joined(false);
+        std::thread joiner([&]
+        {
+            latch.wait();
+            STX_CHECK(finished == tasks);
+            joined = true;
+        });
+        std::vector<std::thread> pool;
+        for (int i = 0; i != tasks - 2; ++i)
+        {
+            pool.emplace_back([&]
+            {
+                ++finished;
+                latch.signal();
+            });
+        }
+        for (std::thread& t : pool)
+            t.join();
+        std::this_thread::sleep_for(10ms);
+        STX_CHECK(!joined);
+        finished += 2;
+        latch.signal(2);
+        joiner.join();
+        STX_CHECK(joined);
+        latch.wait();
+
+        // Rearmed for another round.
+        latch.reset(2);
+        std::thread again([&]
+        {
+            latch.wait();
+        });
+        latch.signal();
+        latch.signal();
+        again.join();
+    }
+}
+
+int main()
+{
+    test_futex();
+    test_event();
+    test_many_waiters();
+    test_race();
+    test_reset();
+    test_wait_any();
+    test_wait_all();
+    test_multi_race();
+    test_auto_reset();
+    test_countdown();
+}
\ No newline at end of file
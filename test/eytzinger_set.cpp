@@ -0,0 +1,96 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/eytzinger_set.hpp>
+#include <stx/traits/find.hpp>
+#include <stx/traits/contains.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    // `it` points to `v[i]`, or is `end` for `i == v.size()`.
+    template<class Set, class T>
+    bool same(Set const& s, typename Set::const_iterator it, std::vector<T> const& v, std::size_t i)
+    {
+        return i == v.size()? it == s.end() : it != s.end() && !(*it < v[i]) && !(v[i] < *it);
+    }
+
+    template<class T, class Compare, class Make>
+    void check(std::vector<T> v, Compare comp, Make make, std::mt19937& rng)
+    {
+        std::sort(v.begin(), v.end(), comp);
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        stx::eytzinger_set<T, Compare> s(v.begin(), v.end(), comp);
+        STX_CHECK(s.size() == v.size());
+        STX_CHECK(s.empty() == v.empty());
+
+        // Both ways in sorted order.
+        STX_CHECK(std::equal(s.begin(), s.end(), v.begin(), v.end()));
+        STX_CHECK(std::equal(std::make_reverse_iterator(s.end()), std::make_reverse_iterator(s.begin()), v.rbegin(), v.rend()));
+
+        for (int k = 0; k != 200; ++k)
+        {
+            T val = v.empty() || k % 2? make(rng) : v[rng() % v.size()];
+            std::size_t lb = std::size_t(std::lower_bound(v.begin(), v.end(), val, comp) - v.begin());
+            std::size_t ub = std::size_t(std::upper_bound(v.begin(), v.end(), val, comp) - v.begin());
+            bool present = lb != ub;
+            STX_CHECK(same(s, s.lower_bound(val), v, lb));
+            STX_CHECK(same(s, s.upper_bound(val), v, ub));
+            STX_CHECK(same(s, s.find(val), v, present? lb : v.size()));
+            STX_CHECK(s.contains(val) == present);
+            STX_CHECK(stx::traits::contains(s, val) == present);
+            STX_CHECK(stx::traits::find(s, val) == s.find(val));
+            // Iterators from a search walk on in order.
+            auto it = s.lower_bound(val);
+            if (lb != v.size() && lb + 1 != v.size())
+                STX_CHECK(same(s, ++it, v, lb + 1));
+            it = s.lower_bound(val);
+            if (lb)
+                STX_CHECK(same(s, --it, v, lb - 1));
+        }
+    }
+
+    template<class T, class Make>
+    void test(Make make)
+    {
+        std::mt19937 rng(42);
+        std::vector<std::size_t> sizes;
+        for (std::size_t n = 0; n != 70; ++n)
+            sizes.push_back(n);
+        sizes.push_back(1023);
+        sizes.push_back(1024);
+        sizes.push_back(5000);
+        for (std::size_t n : sizes)
+        {
+            std::vector<T> v(n);
+            for (T& x : v)
+                x = make(rng);
+            check(v, std::less<T>(), make, rng);
+            check(v, std::greater<T>(), make, rng);
+        }
+    }
+}
+
+int main()
+{
+    test<int>([](std::mt19937& rng) { return int(rng() % 20000) - 10000; });
+    test<std::int64_t>([](std::mt19937& rng) { return std::int64_t(rng()) << 20; });
+    test<double>([](std::mt19937& rng) { return double(rng() % 10000) / 8; });
+    test<std::string>([](std::mt19937& rng) { return std::to_string(rng() % 5000); });
+
+    stx::eytzinger_set<int> empty;
+    STX_CHECK(empty.empty() && empty.begin() == empty.end());
+    STX_CHECK(empty.find(1) == empty.end() && !empty.contains(1));
+    stx::eytzinger_set<int> small{1, 3, 5};
+    STX_CHECK(*small.upper_bound(3) == 5 && small.upper_bound(5) == small.end());
+}
@@ -0,0 +1,132 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/lock_stats.hpp>
+#include <stx/sync/spinlock.hpp>
+#include <stx/sync/sharded_shared_spinlock.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <sstream>
+#include "check.hpp"
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    using stats_spinlock = stx::basic_spinlock<stx::exponential_backoff<>, stx::lock_stats>;
+    using stats_shared_spinlock = stx::basic_shared_spinlock<stx::exponential_backoff<>, stx::lock_stats>;
+
+    void test_percentile()
+    {
+        stx::lock_stats s;
+        STX_CHECK(s.wait_percentile(50) == 0);
+        STX_CHECK(s.wait_percentile(100) == 0);
+
+        // Three quick acquisitions and one that waited about 1000ns.
+        auto now = stx::lock_stats::now();
+        for (int i = 0; i != 3; ++i)
+            s.on_lock(0, now, false);
+        s.on_lock(10, stx::lock_stats::now() - 1000, true);
+        STX_CHECK(s.acquisitions() == 4);
+        STX_CHECK(s.contended() == 1);
+        STX_CHECK(s.wait_percentile(0) == 0);
+        STX_CHECK(s.wait_percentile(50) == 0);
+        // The slowest sample: an upper bound within a factor of 2.
+        std::uint64_t p100 = s.wait_percentile(100);
+        STX_CHECK(p100 >= 1000 && p100 < 4000);
+        STX_CHECK(s.wait_percentile(99.9) == p100);
+
+        s.reset();
+        STX_CHECK(s.acquisitions() == 0 && s.wait_percentile(100) == 0);
+    }
+
+    // An acquisition whose first attempt failed is contended even if it
+    // never had to back off.
+    void test_contended_without_spins()
+    {
+        stx::lock_stats s;
+        s.on_lock(0, stx::lock_stats::now(), true);
+        s.on_lock_shared(0, stx::lock_stats::now(), true);
+        STX_CHECK(s.contended() == 2);
+        STX_CHECK(s.spin_histogram(0) == 2);
+    }
+
+    template<class Lock>
+    void test_lock(Lock& lock)
+    {
+        lock.lock();
+        lock.unlock();
+        STX_CHECK(lock.try_lock());
+        lock.unlock();
+        STX_CHECK(lock.stats().contended() == 0);
+
+        lock.lock();
+        std::atomic<bool> started(false);
+        std::thread waiter([&]
+        {
+            started = true;
+            lock.lock();
+            lock.unlock();
+        });
+        while (!started)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(5ms);
+        lock.unlock();
+        waiter.join();
+
+        auto const& s = lock.stats();
+        STX_CHECK(s.acquisitions() == 4);
+        STX_CHECK(s.contended() == 1);
+        STX_CHECK(s.wait_percentile(100) >= 1000000);
+        STX_CHECK(s.wait_percentile(50) == 0);
+        STX_CHECK(s.max_hold_time() >= 5000000);
+    }
+
+    void test_shared()
+    {
+        stats_shared_spinlock lock;
+        lock.lock_shared();
+        STX_CHECK(lock.try_lock_shared());
+        lock.unlock_shared();
+        lock.unlock_shared();
+        STX_CHECK(lock.stats().shared_acquisitions() == 2);
+        STX_CHECK(lock.stats().acquisitions() == 0);
+        STX_CHECK(lock.stats().contended() == 0);
+    }
+
+    void test_registry()
+    {
+        stx::lock_stats a("alpha");
+        std::size_t live = 0;
+        stx::lock_stats::for_each([&](stx::lock_stats const&) { ++live; });
+        {
+            stx::lock_stats b("beta");
+            b.on_lock(0, stx::lock_stats::now(), false);
+            std::ostringstream os;
+            stx::lock_stats::dump(os);
+            STX_CHECK(os.str().find("beta: acquisitions 1,") != std::string::npos);
+            STX_CHECK(os.str().find("alpha: acquisitions 0,") != std::string::npos);
+        }
+        std::size_t after = 0;
+        stx::lock_stats::for_each([&](stx::lock_stats const&) { ++after; });
+        STX_CHECK(after == live);
+    }
+}
+
+int main()
+{
+    test_percentile();
+    test_contended_without_spins();
+    stats_spinlock spin;
+    test_lock(spin);
+    stats_shared_spinlock shared;
+    test_lock(shared);
+    stx::basic_sharded_shared_spinlock<8, stx::exponential_backoff<>, stx::lock_stats> sharded;
+    test_lock(sharded);
+    test_shared();
+    test_registry();
+}
\ No newline at end of file
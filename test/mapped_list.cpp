@@ -0,0 +1,124 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/mapped_list.hpp>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "check.hpp"
+
+namespace
+{
+    struct record
+    {
+        std::uint64_t id;
+        double value;
+    };
+
+    using list = stx::mapped_list<record>;
+
+    bool holds(list const& m, std::uint64_t n)
+    {
+        std::uint64_t i = 0;
+        for (record const& r : m.list())
+        {
+            if (r.id != i || r.value != double(i) / 2)
+                return false;
+            ++i;
+        }
+        return i == n;
+    }
+
+    // Run `f` in a child process and check that it succeeded.
+    template<class F>
+    void in_child(F f)
+    {
+        pid_t pid = ::fork();
+        STX_CHECK(pid >= 0);
+        if (!pid)
+        {
+            f();
+            ::_exit(0);
+        }
+        int status;
+        STX_CHECK(::waitpid(pid, &status, 0) == pid);
+        STX_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    void test_across_processes(char const* path)
+    {
+        std::uint64_t const n = 10000;
+        void const* old_base;
+        {
+            list m = list::create(path, 1 << 20);
+            for (std::uint64_t i = 0; i != n; ++i)
+                m.list().push_back({i, double(i) / 2});
+            old_base = &m.list();
+            m.flush();
+            m.close();
+            STX_CHECK(!m.is_open());
+        }
+
+        in_child([&]
+        {
+            // Occupy the old address so the file is mapped at another base.
+            long page = ::sysconf(_SC_PAGESIZE);
+            void* hint = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(old_base) / page * page);
+            void* block = ::mmap(hint, 1 << 20, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            STX_CHECK(block == hint);
+            list m = list::open(path);
+            STX_CHECK(static_cast<void const*>(&m.list()) != old_base);
+            STX_CHECK(holds(m, n));
+            // Write back from the child, growing the file on the way.
+            m.grow(4 << 20);
+            for (std::uint64_t i = n; i != 2 * n; ++i)
+                m.list().push_back({i, double(i) / 2});
+            m.flush();
+        });
+
+        list m = list::open(path);
+        STX_CHECK(m.capacity() == 4 << 20);
+        STX_CHECK(holds(m, 2 * n));
+    }
+
+    void test_mismatch(char const* path)
+    {
+        bool threw = false;
+        try
+        {
+            stx::mapped_list<short>::open(path);
+        }
+        catch (std::system_error& e)
+        {
+            threw = e.code() == std::errc::invalid_argument;
+        }
+        STX_CHECK(threw);
+
+        threw = false;
+        try
+        {
+            list::open("/nonexistent/stx_mapped_list");
+        }
+        catch (std::system_error& e)
+        {
+            threw = e.code() == std::errc::no_such_file_or_directory;
+        }
+        STX_CHECK(threw);
+    }
+}
+
+int main()
+{
+    char path[] = "/tmp/stx_mapped_list_XXXXXX";
+    int fd = ::mkstemp(path);
+    STX_CHECK(fd >= 0);
+    ::close(fd);
+    test_across_processes(path);
+    test_mismatch(path);
+    ::unlink(path);
+}
\ No newline at end of file
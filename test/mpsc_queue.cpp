@@ -0,0 +1,157 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/mpsc_queue.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include "check.hpp"
+
+namespace
+{
+    // Counts the live instances to catch leaks and double destruction.
+    struct tracked
+    {
+        static std::atomic<int> live;
+        int value;
+
+        tracked(int value = 0) : value(value)
+        {
+            ++live;
+        }
+
+        tracked(tracked const& other) : value(other.value)
+        {
+            ++live;
+        }
+
+        tracked& operator=(tracked const&) = default;
+
+        ~tracked()
+        {
+            --live;
+        }
+    };
+
+    std::atomic<int> tracked::live(0);
+
+    void test_fifo()
+    {
+        stx::mpsc_queue<tracked> q;
+        STX_CHECK(q.empty());
+        tracked t;
+        STX_CHECK(!q.try_pop(t));
+        for (int i = 0; i != 10; ++i)
+            q.push(i);
+        STX_CHECK(!q.empty());
+        STX_CHECK(q.try_pop(t) && t.value == 0);
+        STX_CHECK(q.try_pop(t) && t.value == 1);
+        // Pushed while the consumer holds a private chain.
+        for (int i = 10; i != 15; ++i)
+            q.emplace(i);
+        int next = 2;
+        std::size_t n = q.consume_all([&](tracked& x)
+        {
+            STX_CHECK(x.value == next++);
+        });
+        STX_CHECK(n == 13 && next == 15);
+        STX_CHECK(q.empty());
+        STX_CHECK(q.consume_all([](tracked&) {}) == 0);
+        STX_CHECK(tracked::live == 1);
+
+        // Leftovers on both sides are destroyed with the queue.
+        {
+            stx::mpsc_queue<tracked> r;
+            r.push(1);
+            r.push(2);
+            STX_CHECK(r.try_pop(t));
+            r.push(3);
+        }
+        STX_CHECK(tracked::live == 1);
+    }
+
+    void test_throwing_consumer()
+    {
+        stx::mpsc_queue<std::string> q;
+        for (int i = 0; i != 6; ++i)
+            q.push(std::string(30, char('a' + i)));
+        bool threw = false;
+        try
+        {
+            q.consume_all([](std::string& s)
+            {
+                if (s[0] == 'c')
+                    throw std::runtime_error("stop");
+            });
+        }
+        catch (std::runtime_error&)
+        {
+            threw = true;
+        }
+        STX_CHECK(threw);
+        // 'c' was dropped, the rest is still queued in order.
+        std::string s;
+        for (char c : {'d', 'e', 'f'})
+            STX_CHECK(q.try_pop(s) && s[0] == c);
+        STX_CHECK(q.empty());
+    }
+
+    // Producers tag their elements; each producer's sequence must come
+    // out in order and complete.
+    void test_concurrent()
+    {
+        unsigned const producers = 4;
+        int const per_producer = 20000;
+        stx::mpsc_queue<std::pair<unsigned, int>> q;
+        std::atomic<unsigned> done(0);
+        std::vector<std::thread> threads;
+        for (unsigned p = 0; p != producers; ++p)
+        {
+            threads.emplace_back([&, p]
+            {
+                for (int i = 0; i != per_producer; ++i)
+                    q.emplace(p, i);
+                ++done;
+            });
+        }
+        std::vector<int> next(producers, 0);
+        auto check = [&](std::pair<unsigned, int> const& x)
+        {
+            STX_CHECK(x.first < producers && x.second == next[x.first]++);
+        };
+        std::size_t total = 0;
+        bool alternate = false;
+        while (done.load() != producers || !q.empty())
+        {
+            if ((alternate = !alternate))
+                total += q.consume_all(check);
+            else
+            {
+                std::pair<unsigned, int> x;
+                if (q.try_pop(x))
+                {
+                    check(x);
+                    ++total;
+                }
+            }
+        }
+        for (std::thread& t : threads)
+            t.join();
+        total += q.consume_all(check);
+        STX_CHECK(total == producers * std::size_t(per_producer));
+        for (int n : next)
+            STX_CHECK(n == per_producer);
+    }
+}
+
+int main()
+{
+    test_fifo();
+    test_throwing_consumer();
+    test_concurrent();
+}
\ No newline at end of file
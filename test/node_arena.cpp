@@ -0,0 +1,137 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/memory/node_arena.hpp>
+#include <stx/container/offset_list.hpp>
+#include <set>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include "check.hpp"
+
+namespace
+{
+    bool aligned(void const* p, std::size_t align)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+    }
+
+    struct alignas(32) wide
+    {
+        char data[40];
+    };
+
+    void test_geometry()
+    {
+        stx::node_arena a;
+        STX_CHECK(a.block_size() == 0);
+        void* p = a.allocate(12, 4);
+        // The first allocation fixes the geometry, rounded up to hold a link.
+        STX_CHECK(a.block_align() == alignof(void*));
+        STX_CHECK(a.block_size() == 16);
+        STX_CHECK(aligned(p, alignof(void*)));
+        a.deallocate(p, 12, 4);
+
+        stx::node_arena b(sizeof(wide), alignof(wide));
+        STX_CHECK(b.block_size() == 64);
+        for (int i = 0; i != 100; ++i)
+            STX_CHECK(aligned(b.allocate(sizeof(wide), alignof(wide)), alignof(wide)));
+    }
+
+    void test_recycling()
+    {
+        stx::node_arena a(16, 8, 1024);
+        std::vector<void*> blocks;
+        for (int i = 0; i != 200; ++i)
+            blocks.push_back(a.allocate(16, 8));
+        STX_CHECK(std::set<void*>(blocks.begin(), blocks.end()).size() == blocks.size());
+        for (void* p : blocks)
+            a.deallocate(p, 16, 8);
+        // Freed blocks come back before any new chunk is carved.
+        std::set<void*> freed(blocks.begin(), blocks.end());
+        for (int i = 0; i != 200; ++i)
+            STX_CHECK(freed.count(a.allocate(16, 8)) == 1);
+    }
+
+    void test_contiguous()
+    {
+        stx::node_arena a(24, 8, 256);
+        char* p = static_cast<char*>(a.allocate(24, 8, 20));
+        // Larger than a chunk, so it gets a chunk of its own.
+        for (int i = 0; i != 20; ++i)
+            p[i * 24] = char(i);
+        // Blocks allocated together may be deallocated one by one.
+        a.deallocate(p + 5 * 24, 24, 8);
+        STX_CHECK(a.allocate(24, 8) == p + 5 * 24);
+        a.deallocate(p, 24, 8, 5);
+        std::set<void*> got;
+        for (int i = 0; i != 5; ++i)
+            got.insert(a.allocate(24, 8));
+        for (int i = 0; i != 5; ++i)
+            STX_CHECK(got.count(p + i * 24) == 1);
+    }
+
+    void test_heap_fallback()
+    {
+        stx::node_arena a(16, 8);
+        // Requests that don't fit a block go to the heap with their alignment.
+        void* big = a.allocate(100, 8);
+        void* over = a.allocate(16, 128);
+        STX_CHECK(aligned(over, 128));
+        static_cast<char*>(big)[99] = 1;
+        static_cast<char*>(over)[15] = 1;
+        a.deallocate(big, 100, 8);
+        a.deallocate(over, 16, 128);
+    }
+
+    void test_release_and_move()
+    {
+        stx::node_arena a(8, 8, 128);
+        for (int i = 0; i != 100; ++i)
+            a.allocate(8, 8);
+        stx::node_arena b(std::move(a));
+        STX_CHECK(b.block_size() == 8);
+        a.release();
+        b.release();
+        void* p = b.allocate(8, 8);
+        STX_CHECK(p != nullptr);
+    }
+
+    void test_offset_list()
+    {
+        using list = stx::offset_list<int, stx::arena_allocator<int>>;
+        stx::node_arena arena;
+        {
+            list l{stx::arena_allocator<int>(arena)};
+            for (int i = 0; i != 10000; ++i)
+                l.push_back(i);
+            // Erase the odd ones and put them back in front.
+            l.remove_if([](int x)
+            {
+                return x & 1;
+            });
+            for (int i = 1; i < 10000; i += 2)
+                l.push_front(i);
+            STX_CHECK(l.size() == 10000);
+            STX_CHECK(std::accumulate(l.begin(), l.end(), 0LL) == 10000LL * 9999 / 2);
+            STX_CHECK(l.front() == 9999 && l.back() == 9998);
+            list copy(l);
+            STX_CHECK(copy == l);
+            STX_CHECK(&copy.get_allocator().arena() == &arena);
+        }
+        arena.release();
+    }
+}
+
+int main()
+{
+    test_geometry();
+    test_recycling();
+    test_contiguous();
+    test_heap_fallback();
+    test_release_and_move();
+    test_offset_list();
+}
\ No newline at end of file
@@ -0,0 +1,454 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/offset_list.hpp>
+#include <map>
+#include <memory>
+#include <list>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <iterator>
+#include "check.hpp"
+
+namespace
+{
+    using counted_list = stx::offset_list<int, std::allocator<int>, true>;
+
+    template<class List>
+    bool same(List const& l, std::list<int> const& model)
+    {
+        return l.size() == model.size()
+            && std::size_t(std::distance(l.begin(), l.end())) == model.size()
+            && std::equal(l.begin(), l.end(), model.begin(), model.end())
+            && std::equal(l.rbegin(), l.rend(), model.rbegin(), model.rend());
+    }
+
+    void test_layout()
+    {
+        // The count is opt-in; the default list stays two offsets.
+        static_assert(sizeof(stx::offset_list<int>) == 2 * sizeof(std::ptrdiff_t), "");
+        static_assert(sizeof(counted_list) == 3 * sizeof(std::ptrdiff_t), "");
+    }
+
+    // Apply the same random operations to two lists and their models,
+    // checking the cached count after each one.
+    void test_count()
+    {
+        std::mt19937 rng(1);
+        counted_list a, b;
+        std::list<int> ma, mb;
+        auto pick = [&](std::size_t n)
+        {
+            return std::size_t(rng() % (n + 1));
+        };
+        for (int step = 0; step != 20000; ++step)
+        {
+            counted_list& l = step & 1? a : b;
+            counted_list& o = step & 1? b : a;
+            std::list<int>& m = step & 1? ma : mb;
+            std::list<int>& mo = step & 1? mb : ma;
+            int v = int(rng() % 100);
+            std::size_t k = pick(m.size());
+            switch (rng() % 16)
+            {
+            case 0:
+                l.push_back(v);
+                m.push_back(v);
+                break;
+            case 1:
+                l.push_front(v);
+                m.push_front(v);
+                break;
+            case 2:
+                if (!m.empty())
+                {
+                    l.pop_back();
+                    m.pop_back();
+                }
+                break;
+            case 3:
+                if (!m.empty())
+                {
+                    l.pop_front();
+                    m.pop_front();
+                }
+                break;
+            case 4:
+            {
+                std::size_t n = pick(5);
+                l.insert(std::next(l.begin(), k), n, v);
+                m.insert(std::next(m.begin(), k), n, v);
+                break;
+            }
+            case 5:
+            {
+                std::size_t j = k + pick(m.size() - k);
+                l.erase(std::next(l.begin(), k), std::next(l.begin(), j));
+                m.erase(std::next(m.begin(), k), std::next(m.begin(), j));
+                break;
+            }
+            case 6:
+                if (k != m.size())
+                {
+                    l.erase(std::next(l.begin(), k));
+                    m.erase(std::next(m.begin(), k));
+                }
+                break;
+            case 7:
+            {
+                std::size_t n = pick(m.size() + 4);
+                l.resize(n, v);
+                m.resize(n, v);
+                break;
+            }
+            case 8:
+                l.splice(std::next(l.begin(), k), o);
+                m.splice(std::next(m.begin(), k), mo);
+                break;
+            case 9:
+                if (!mo.empty())
+                {
+                    std::size_t j = pick(mo.size() - 1);
+                    l.splice(std::next(l.begin(), k), o, std::next(o.begin(), j));
+                    m.splice(std::next(m.begin(), k), mo, std::next(mo.begin(), j));
+                }
+                break;
+            case 10:
+            {
+                std::size_t i = pick(mo.size());
+                std::size_t j = i + pick(mo.size() - i);
+                l.splice(std::next(l.begin(), k), o, std::next(o.begin(), i), std::next(o.begin(), j));
+                m.splice(std::next(m.begin(), k), mo, std::next(mo.begin(), i), std::next(mo.begin(), j));
+                break;
+            }
+            case 11:
+                // Splice within the same list, which keeps the count.
+                if (k && k != m.size())
+                {
+                    std::size_t j = k + pick(m.size() - k);
+                    l.splice(l.begin(), l, std::next(l.begin(), k), std::next(l.begin(), j));
+                    m.splice(m.begin(), m, std::next(m.begin(), k), std::next(m.begin(), j));
+                }
+                break;
+            case 12:
+                l.swap(o);
+                m.swap(mo);
+                break;
+            case 13:
+                l.remove(v % 10);
+                m.remove(v % 10);
+                break;
+            case 14:
+                l.unique();
+                m.unique();
+                break;
+            default:
+                if (rng() % 8 == 0)
+                {
+                    l.clear();
+                    m.clear();
+                }
+                break;
+            }
+            STX_CHECK(same(a, ma));
+            STX_CHECK(same(b, mb));
+        }
+    }
+
+    void test_count_copy_move()
+    {
+        counted_list a{1, 2, 3, 4};
+        counted_list b(a);
+        STX_CHECK(b.size() == 4);
+        counted_list c(std::move(a));
+        STX_CHECK(c.size() == 4 && a.size() == 0 && a.empty());
+        a = c;
+        STX_CHECK(a.size() == 4);
+        b = {7, 8};
+        STX_CHECK(b.size() == 2);
+        c = std::move(b);
+        STX_CHECK(c.size() == 2 && b.size() == 0);
+        a.assign(10, 5);
+        STX_CHECK(a.size() == 10);
+    }
+
+    using item = std::pair<int, int>; // key, original position
+
+    bool by_key(item const& a, item const& b)
+    {
+        return a.first < b.first;
+    }
+
+    void test_sort()
+    {
+        std::mt19937 rng(2);
+        for (std::size_t n : {0, 1, 2, 3, 7, 64, 100, 1000, 4097})
+        {
+            stx::offset_list<item> l;
+            std::vector<item> v;
+            for (int i = 0; i != int(n); ++i)
+            {
+                item x(int(rng() % (n / 4 + 1)), i);
+                l.push_back(x);
+                v.push_back(x);
+            }
+            // Nodes are relinked, so each element stays at its address.
+            std::map<int, item const*> where;
+            for (item const& x : l)
+                where[x.second] = &x;
+            l.sort(by_key);
+            std::stable_sort(v.begin(), v.end(), by_key);
+            STX_CHECK(std::equal(l.begin(), l.end(), v.begin(), v.end()));
+            STX_CHECK(std::equal(l.rbegin(), l.rend(), v.rbegin(), v.rend()));
+            for (item const& x : l)
+                STX_CHECK(where[x.second] == &x);
+        }
+
+        counted_list c{5, 3, 9, 1, 3};
+        c.sort(std::greater<>());
+        STX_CHECK((c == counted_list{9, 5, 3, 3, 1}));
+        STX_CHECK(c.size() == 5);
+        c.sort();
+        c.push_back(10);
+        STX_CHECK((c == counted_list{1, 3, 3, 5, 9, 10}));
+    }
+
+    void test_sort_throws()
+    {
+        counted_list l;
+        for (int i = 0; i != 500; ++i)
+            l.push_back((i * 7919) % 500);
+        int calls = 0;
+        try
+        {
+            l.sort([&](int a, int b)
+            {
+                if (++calls == 2000)
+                    throw std::runtime_error("cmp");
+                return a < b;
+            });
+            STX_CHECK(false);
+        }
+        catch (std::runtime_error&)
+        {
+        }
+        // Basic guarantee: every element is still linked exactly once.
+        std::vector<int> v(l.begin(), l.end());
+        STX_CHECK(v.size() == 500 && l.size() == 500);
+        std::vector<int> r(l.rbegin(), l.rend());
+        std::reverse(r.begin(), r.end());
+        STX_CHECK(v == r);
+        std::sort(v.begin(), v.end());
+        for (int i = 0; i != 500; ++i)
+            STX_CHECK(v[i] == i);
+    }
+
+    void test_merge()
+    {
+        std::mt19937 rng(3);
+        for (int round = 0; round != 50; ++round)
+        {
+            stx::offset_list<item, std::allocator<item>, true> a, b;
+            std::vector<item> va, vb;
+            for (int i = 0, n = int(rng() % 100); i != n; ++i)
+                va.emplace_back(int(rng() % 20), i);
+            for (int i = 0, n = int(rng() % 100); i != n; ++i)
+                vb.emplace_back(int(rng() % 20), 1000 + i);
+            std::stable_sort(va.begin(), va.end(), by_key);
+            std::stable_sort(vb.begin(), vb.end(), by_key);
+            a.assign(va.begin(), va.end());
+            b.assign(vb.begin(), vb.end());
+            a.merge(b, by_key);
+            // Equivalent elements of `a` precede those of `b`.
+            std::vector<item> expect;
+            std::merge(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expect), by_key);
+            STX_CHECK(std::equal(a.begin(), a.end(), expect.begin(), expect.end()));
+            STX_CHECK(std::equal(a.rbegin(), a.rend(), expect.rbegin(), expect.rend()));
+            STX_CHECK(a.size() == expect.size());
+            STX_CHECK(b.empty() && b.size() == 0);
+            b.push_back(item(0, 0));
+            STX_CHECK(b.size() == 1 && b.front() == item(0, 0));
+        }
+
+        stx::offset_list<int> x{1, 4, 6}, y{2, 3, 5, 7};
+        x.merge(std::move(y));
+        STX_CHECK((x == stx::offset_list<int>{1, 2, 3, 4, 5, 6, 7}));
+        x.merge(x);
+        STX_CHECK(x.size() == 7);
+    }
+
+    // Memory is only returned at the end, so that the blocks of a batch
+    // can be deallocated in parts.
+    struct alloc_stats
+    {
+        std::size_t calls = 0;
+        std::size_t live = 0;
+        std::vector<std::unique_ptr<char[]>> chunks;
+    };
+
+    // Counts the calls to allocate(), optionally declaring that a batch
+    // may be deallocated in parts.
+    template<class T, bool Divisible>
+    struct counting_allocator
+    {
+        using value_type = T;
+        using divisible_allocation = std::integral_constant<bool, Divisible>;
+
+        alloc_stats* stats;
+
+        template<class U>
+        struct rebind
+        {
+            using other = counting_allocator<U, Divisible>;
+        };
+
+        explicit counting_allocator(alloc_stats* stats) noexcept : stats(stats) {}
+
+        template<class U>
+        counting_allocator(counting_allocator<U, Divisible> const& other) noexcept
+          : stats(other.stats)
+        {}
+
+        T* allocate(std::size_t n)
+        {
+            ++stats->calls;
+            stats->live += n;
+            stats->chunks.emplace_back(new char[n * sizeof(T) + alignof(T)]);
+            std::size_t space = n * sizeof(T) + alignof(T);
+            void* p = stats->chunks.back().get();
+            return static_cast<T*>(std::align(alignof(T), n * sizeof(T), p, space));
+        }
+
+        void deallocate(T*, std::size_t n) noexcept
+        {
+            stats->live -= n;
+        }
+
+        template<class U>
+        bool operator==(counting_allocator<U, Divisible> const& other) const noexcept
+        {
+            return stats == other.stats;
+        }
+
+        template<class U>
+        bool operator!=(counting_allocator<U, Divisible> const& other) const noexcept
+        {
+            return stats != other.stats;
+        }
+    };
+
+    // Throws when copied while `budget` hits zero.
+    struct fragile
+    {
+        static int budget;
+        int value;
+
+        fragile(int value) : value(value) {}
+
+        fragile(fragile const& other) : value(other.value)
+        {
+            if (!budget--)
+                throw std::runtime_error("copy");
+        }
+
+        bool operator==(fragile const& other) const
+        {
+            return value == other.value;
+        }
+    };
+
+    int fragile::budget = -1;
+
+    template<bool Divisible>
+    void test_batch_allocation()
+    {
+        alloc_stats stats;
+        using alloc = counting_allocator<int, Divisible>;
+        {
+            stx::offset_list<int, alloc, true> l{alloc(&stats)};
+            l.push_back(0);
+            l.push_back(4);
+            stats.calls = 0;
+            auto it = l.insert(std::next(l.begin()), 1000, 7);
+            STX_CHECK(std::distance(l.begin(), it) == 1 && *it == 7);
+            STX_CHECK(stats.calls == (Divisible? 1 : 1000));
+            STX_CHECK(l.size() == 1002 && l.front() == 0 && l.back() == 4);
+            std::vector<int> v(500, 3);
+            stats.calls = 0;
+            l.append_range(v);
+            STX_CHECK(stats.calls == (Divisible? 1 : 500));
+            l.resize(3000, 9);
+            STX_CHECK(l.size() == 3000 && l.back() == 9);
+            l.erase(std::next(l.begin(), 10), std::next(l.begin(), 2000));
+            STX_CHECK(l.size() == 1010);
+            STX_CHECK(stats.live == 1010);
+        }
+        STX_CHECK(stats.live == 0);
+
+        // A failed batch leaves the list as it was and frees every node.
+        using falloc = counting_allocator<fragile, Divisible>;
+        stx::offset_list<fragile, falloc, true> f{falloc(&stats)};
+        f.push_back(1);
+        f.push_back(2);
+        std::vector<fragile> src(100, fragile(5));
+        fragile::budget = 50;
+        bool threw = false;
+        try
+        {
+            f.insert(std::next(f.begin()), src.begin(), src.end());
+        }
+        catch (std::runtime_error&)
+        {
+            threw = true;
+        }
+        fragile::budget = -1;
+        STX_CHECK(threw);
+        STX_CHECK(f.size() == 2 && f.front().value == 1 && f.back().value == 2);
+        STX_CHECK(stats.live == 2);
+    }
+
+    void test_ranges()
+    {
+        counted_list l{5};
+        std::list<int> tail{6, 7, 8};
+        l.append_range(tail);
+        l.prepend_range(std::vector<int>{1, 2});
+        int arr[] = {3, 4};
+        auto it = l.insert_range(std::next(l.begin(), 2), arr);
+        STX_CHECK(*it == 3);
+        STX_CHECK((l == counted_list{1, 2, 3, 4, 5, 6, 7, 8}));
+        STX_CHECK(l.size() == 8);
+
+        // Single-pass input is inserted as it comes.
+        std::istringstream in("10 11 12");
+        it = l.insert(l.end(), std::istream_iterator<int>(in), std::istream_iterator<int>());
+        STX_CHECK(*it == 10 && l.size() == 11 && l.back() == 12);
+
+        // Nothing inserted returns `pos`.
+        std::vector<int> none;
+        it = l.insert(std::next(l.begin()), none.begin(), none.end());
+        STX_CHECK(*it == 2);
+        it = l.insert(l.end(), 0, 1);
+        STX_CHECK(it == l.end() && l.size() == 11);
+    }
+}
+
+int main()
+{
+    test_layout();
+    test_count();
+    test_count_copy_move();
+    test_sort();
+    test_sort_throws();
+    test_merge();
+    test_batch_allocation<true>();
+    test_batch_allocation<false>();
+    test_ranges();
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/queue_lock.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    using namespace std::chrono_literals;
+    using std::chrono::steady_clock;
+
+    template<class Lock>
+    void test_basic()
+    {
+        Lock lock;
+        STX_CHECK(lock.try_lock());
+        STX_CHECK(!lock.try_lock());
+        lock.unlock();
+        lock.lock();
+        lock.unlock();
+        STX_CHECK(lock.try_lock());
+        lock.unlock();
+
+        // try_lock returns at once while another thread holds the lock.
+        lock.lock();
+        std::thread other([&]
+        {
+            auto start = steady_clock::now();
+            for (int i = 0; i != 1000; ++i)
+                STX_CHECK(!lock.try_lock());
+            STX_CHECK(steady_clock::now() - start < 1s);
+        });
+        other.join();
+        lock.unlock();
+    }
+
+    // Threads mixing lock() and try_lock() on a few locks, nesting them in
+    // a fixed order, with unguarded counters to catch overlap.
+    template<class Lock>
+    void test_exclusion()
+    {
+        // Fair locks hand over to preempted waiters when threads outnumber
+        // the cores, which costs a time slice each.
+        int const threads = 4;
+        int const rounds = std::thread::hardware_concurrency() < threads? 200 : 20000;
+        std::unique_ptr<Lock[]> locks(new Lock[3]);
+        long counters[3] = {};
+        std::atomic<long> tried(0);
+        std::vector<std::thread> pool;
+        for (int t = 0; t != threads; ++t)
+        {
+            pool.emplace_back([&, t]
+            {
+                for (int i = 0; i != rounds; ++i)
+                {
+                    int k = (i + t) % 3;
+                    if ((i + t) & 1)
+                    {
+                        if (!locks[k].try_lock())
+                            continue;
+                        ++tried;
+                    }
+                    else
+                        locks[k].lock();
+                    ++counters[k];
+                    if (k != 2)
+                    {
+                        locks[2].lock();
+                        ++counters[2];
+                        locks[2].unlock();
+                    }
+                    locks[k].unlock();
+                }
+            });
+        }
+        for (std::thread& th : pool)
+            th.join();
+        long locked = long(threads) * rounds / 2;
+        long total = counters[0] + counters[1] + counters[2];
+        // Each pass over lock 0 or 1 also takes lock 2 once.
+        STX_CHECK(total == locked + tried + counters[0] + counters[1]);
+        STX_CHECK(tried > 0);
+    }
+
+    // Locks created and destroyed while threads use others, so nodes move
+    // between locks through the pool.
+    void test_churn()
+    {
+        std::vector<std::thread> pool;
+        for (int t = 0; t != 4; ++t)
+        {
+            pool.emplace_back([]
+            {
+                for (int i = 0; i != 200; ++i)
+                {
+                    stx::clh_lock a, b;
+                    for (int j = 0; j != 10; ++j)
+                    {
+                        std::lock_guard<stx::clh_lock> ga(a);
+                        if (b.try_lock())
+                            b.unlock();
+                    }
+                }
+            });
+        }
+        for (std::thread& th : pool)
+            th.join();
+    }
+}
+
+int main()
+{
+    test_basic<stx::ticket_lock>();
+    test_basic<stx::clh_lock>();
+    test_exclusion<stx::ticket_lock>();
+    test_exclusion<stx::clh_lock>();
+    test_churn();
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/relocatable_list.hpp>
+#include <new>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include "check.hpp"
+
+namespace
+{
+    using list = stx::relocatable_list<long>;
+
+    bool equals(list::list_type const& l, std::vector<long> const& v)
+    {
+        return std::equal(l.begin(), l.end(), v.begin(), v.end());
+    }
+
+    void test_relocate()
+    {
+        std::size_t const cap = 64 * 1024;
+        void* a = std::malloc(cap);
+        list* p = list::create(a, cap);
+        std::vector<long> expect;
+        for (long i = 0; i != 1000; ++i)
+        {
+            p->list().push_back(i);
+            expect.push_back(i);
+        }
+        p->list().remove_if([](long x)
+        {
+            return x % 3 == 0;
+        });
+        expect.erase(std::remove_if(expect.begin(), expect.end(), [](long x)
+        {
+            return x % 3 == 0;
+        }), expect.end());
+
+        void* b = std::malloc(cap);
+        list* q = p->relocate(b, cap);
+        // Wipe the source so nothing can still point into it.
+        std::memset(a, 0xcd, cap);
+        std::free(a);
+        STX_CHECK(equals(q->list(), expect));
+        STX_CHECK(std::equal(q->list().rbegin(), q->list().rend(), expect.rbegin(), expect.rend()));
+
+        // The moved list keeps working, reusing the erased nodes first.
+        std::size_t used = q->size_in_bytes();
+        for (long i = 0; i != 100; ++i)
+        {
+            q->list().push_front(-i);
+            expect.insert(expect.begin(), -i);
+        }
+        STX_CHECK(q->size_in_bytes() == used);
+        STX_CHECK(equals(q->list(), expect));
+        q->~list();
+        std::free(b);
+    }
+
+    void test_grow()
+    {
+        std::size_t cap = 256;
+        void* buf = std::malloc(cap);
+        list* p = list::create(buf, cap);
+        long n = 0;
+        for (int round = 0; round != 8; ++round)
+        {
+            try
+            {
+                for (;;)
+                    p->list().push_back(n++);
+            }
+            catch (std::bad_alloc&)
+            {
+                --n;
+            }
+            STX_CHECK(p->size_in_bytes() <= cap);
+            // Grow in place or elsewhere; either way no fixups are needed.
+            cap *= 2;
+            buf = std::realloc(buf, cap);
+            p = list::from(buf);
+            p->set_capacity(cap);
+            STX_CHECK(p->capacity() == cap);
+        }
+        long i = 0;
+        for (long x : p->list())
+            STX_CHECK(x == i++);
+        STX_CHECK(i == n);
+        p->~list();
+        std::free(buf);
+    }
+
+    void test_arena()
+    {
+        alignas(std::max_align_t) char buf[512];
+        stx::relocatable_arena* a = new(buf) stx::relocatable_arena(sizeof(buf), sizeof(stx::relocatable_arena), 12, 4);
+        char* blocks = static_cast<char*>(a->allocate(12, 4, 4));
+        STX_CHECK(blocks >= buf + sizeof(stx::relocatable_arena));
+        std::size_t used = a->size();
+        a->deallocate(blocks + 16, 12, 4);
+        a->deallocate(blocks + 48, 12, 4);
+        STX_CHECK(a->allocate(12, 4) == blocks + 48);
+        STX_CHECK(a->allocate(12, 4) == blocks + 16);
+        STX_CHECK(a->size() == used);
+        bool threw = false;
+        try
+        {
+            a->allocate(64, 4);
+        }
+        catch (std::bad_alloc&)
+        {
+            threw = true;
+        }
+        STX_CHECK(threw);
+    }
+}
+
+int main()
+{
+    test_relocate();
+    test_grow();
+    test_arena();
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/seqlock.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    // Trivially copyable, but not default constructible.
+    struct quote
+    {
+        long bid, ask, seq;
+
+        quote(long bid, long ask, long seq) noexcept : bid(bid), ask(ask), seq(seq) {}
+    };
+
+    static_assert(!std::is_default_constructible<quote>::value, "");
+
+    struct alignas(32) wide
+    {
+        char c[40];
+    };
+
+    struct odd
+    {
+        char c[3];
+    };
+
+    void test_values()
+    {
+        stx::seqlock<quote> q(quote(1, 2, 3));
+        quote v = q.load();
+        STX_CHECK(v.bid == 1 && v.ask == 2 && v.seq == 3);
+        q.store(quote(4, 5, 6));
+        v = q.load();
+        STX_CHECK(v.bid == 4 && v.ask == 5 && v.seq == 6);
+
+        stx::seqlock<int> i;
+        STX_CHECK(i.load() == 0);
+        i.store(-7);
+        STX_CHECK(i.load() == -7);
+
+        wide w{};
+        for (int k = 0; k != 40; ++k)
+            w.c[k] = char(k);
+        stx::seqlock<wide> sw(w);
+        wide r = sw.load();
+        for (int k = 0; k != 40; ++k)
+            STX_CHECK(r.c[k] == char(k));
+
+        stx::seqlock<odd> so(odd{{'a', 'b', 'c'}});
+        odd o = so.load();
+        STX_CHECK(o.c[0] == 'a' && o.c[1] == 'b' && o.c[2] == 'c');
+    }
+
+    // Readers never see a snapshot mixing two stores, and see the stores
+    // of each writer in order.
+    void test_consistency()
+    {
+        stx::seqlock<quote> q(quote(0, 0, 0));
+        int const writers = 2, stores = 20000;
+        std::atomic<int> done(0);
+        std::vector<std::thread> pool;
+        for (int r = 0; r != 3; ++r)
+        {
+            pool.emplace_back([&]
+            {
+                long last[writers] = {};
+                while (done != writers)
+                {
+                    quote v = q.load();
+                    STX_CHECK(v.ask == v.bid * 2 + v.seq);
+                    if (v.bid)
+                    {
+                        STX_CHECK(v.bid >= last[v.seq]);
+                        last[v.seq] = v.bid;
+                    }
+                }
+            });
+        }
+        for (int w = 0; w != writers; ++w)
+        {
+            pool.emplace_back([&, w]
+            {
+                for (long i = 1; i <= stores; ++i)
+                    q.store(quote(i, i * 2 + w, w));
+                ++done;
+            });
+        }
+        for (std::thread& t : pool)
+            t.join();
+        quote v = q.load();
+        STX_CHECK(v.bid == stores && v.ask == v.bid * 2 + v.seq);
+    }
+
+    // The bare counter, with writers serialized by lock_write().
+    void test_seqcount()
+    {
+        stx::seqcount seq;
+        std::atomic<long> a(0), b(0);
+        std::atomic<bool> stop(false);
+        std::thread reader([&]
+        {
+            while (!stop)
+            {
+                long x, y;
+                std::uint32_t s;
+                do
+                {
+                    s = seq.read_begin();
+                    x = a.load(std::memory_order_relaxed);
+                    y = b.load(std::memory_order_relaxed);
+                } while (seq.read_retry(s));
+                STX_CHECK(x == y);
+                STX_CHECK(!(s & 1));
+            }
+        });
+        std::vector<std::thread> writers;
+        for (int w = 0; w != 2; ++w)
+        {
+            writers.emplace_back([&]
+            {
+                for (int i = 0; i != 10000; ++i)
+                {
+                    seq.lock_write();
+                    a.store(a.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                    b.store(b.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                    seq.write_end();
+                }
+            });
+        }
+        for (std::thread& t : writers)
+            t.join();
+        stop = true;
+        reader.join();
+        STX_CHECK(a == 20000 && b == 20000);
+        std::uint32_t s = seq.read_begin();
+        STX_CHECK(s == 40000 && !seq.read_retry(s));
+    }
+}
+
+int main()
+{
+    test_values();
+    test_consistency();
+    test_seqcount();
+}
\ No newline at end of file
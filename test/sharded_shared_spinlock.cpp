@@ -0,0 +1,135 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/sharded_shared_spinlock.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    template<class Lock>
+    void test_basic()
+    {
+        Lock lock;
+        STX_CHECK(lock.try_lock());
+        STX_CHECK(!lock.try_lock());
+        STX_CHECK(!lock.try_lock_shared());
+        lock.unlock();
+
+        // Readers share the lock, and keep writers out.
+        lock.lock_shared();
+        STX_CHECK(lock.try_lock_shared());
+        STX_CHECK(!lock.try_lock());
+        std::thread other([&]
+        {
+            STX_CHECK(lock.try_lock_shared());
+            STX_CHECK(!lock.try_lock());
+            lock.unlock_shared();
+        });
+        other.join();
+        lock.unlock_shared();
+        STX_CHECK(!lock.try_lock());
+        lock.unlock_shared();
+        STX_CHECK(lock.try_lock());
+        lock.unlock();
+    }
+
+    // A writer waits for the readers already in, whatever their slot.
+    template<class Lock>
+    void test_writer_waits()
+    {
+        Lock lock;
+        std::atomic<int> in(0);
+        std::atomic<bool> release(false), written(false);
+        std::vector<std::thread> readers;
+        for (int r = 0; r != 4; ++r)
+        {
+            readers.emplace_back([&]
+            {
+                lock.lock_shared();
+                ++in;
+                while (!release)
+                    std::this_thread::yield();
+                STX_CHECK(!written);
+                lock.unlock_shared();
+            });
+        }
+        while (in != 4)
+            std::this_thread::yield();
+        std::thread writer([&]
+        {
+            lock.lock();
+            written = true;
+            lock.unlock();
+        });
+        std::this_thread::sleep_for(5ms);
+        STX_CHECK(!written);
+        release = true;
+        for (std::thread& t : readers)
+            t.join();
+        writer.join();
+        STX_CHECK(written);
+    }
+
+    // Readers check that the writers' two updates are never seen apart.
+    template<class Lock>
+    void test_exclusion(int readers)
+    {
+        Lock lock;
+        long a = 0, b = 0;
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> pool;
+        for (int r = 0; r != readers; ++r)
+        {
+            pool.emplace_back([&]
+            {
+                while (!stop)
+                {
+                    std::shared_lock<Lock> guard(lock);
+                    STX_CHECK(a == b);
+                }
+            });
+        }
+        std::vector<std::thread> writers;
+        for (int w = 0; w != 2; ++w)
+        {
+            writers.emplace_back([&]
+            {
+                for (int i = 0; i != 3000; ++i)
+                {
+                    std::lock_guard<Lock> guard(lock);
+                    ++a;
+                    ++b;
+                }
+            });
+        }
+        for (std::thread& t : writers)
+            t.join();
+        stop = true;
+        for (std::thread& t : pool)
+            t.join();
+        STX_CHECK(a == 6000 && b == 6000);
+    }
+}
+
+int main()
+{
+    test_basic<stx::sharded_shared_spinlock>();
+    test_writer_waits<stx::sharded_shared_spinlock>();
+    test_exclusion<stx::sharded_shared_spinlock>(3);
+    // More threads than slots: readers share counters.
+    using two_slots = stx::basic_sharded_shared_spinlock<2>;
+    test_basic<two_slots>();
+    test_writer_waits<two_slots>();
+    test_exclusion<two_slots>(5);
+}
\ No newline at end of file
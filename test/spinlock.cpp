@@ -0,0 +1,211 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/sync/spinlock.hpp>
+#include <mutex>
+#include <chrono>
+#include <shared_mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    // Counts how often waiters back off.
+    struct counting_backoff
+    {
+        static std::atomic<unsigned> calls;
+
+        void operator()() noexcept
+        {
+            ++calls;
+            std::this_thread::yield();
+        }
+    };
+
+    std::atomic<unsigned> counting_backoff::calls(0);
+
+    // Increment a plain counter from several threads under the lock.
+    template<class Lock>
+    void test_exclusion()
+    {
+        Lock lock;
+        long counter = 0;
+        unsigned const threads = 4;
+        int const iterations = 20000;
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t != threads; ++t)
+        {
+            pool.emplace_back([&]
+            {
+                for (int i = 0; i != iterations; ++i)
+                {
+                    std::lock_guard<Lock> guard(lock);
+                    ++counter;
+                }
+            });
+        }
+        for (std::thread& th : pool)
+            th.join();
+        STX_CHECK(counter == long(threads) * iterations);
+    }
+
+    void test_try_lock()
+    {
+        stx::spinlock lock;
+        STX_CHECK(lock.try_lock());
+        STX_CHECK(!lock.try_lock());
+        std::thread([&]
+        {
+            STX_CHECK(!lock.try_lock());
+        }).join();
+        lock.unlock();
+        STX_CHECK(lock.try_lock());
+        lock.unlock();
+    }
+
+    void test_backoff_used()
+    {
+        stx::basic_spinlock<counting_backoff> lock;
+        lock.lock();
+        std::atomic<bool> acquired(false);
+        std::thread waiter([&]
+        {
+            lock.lock();
+            acquired = true;
+            lock.unlock();
+        });
+        // The waiter can only back off while we hold the lock.
+        while (counting_backoff::calls.load() < 10)
+            std::this_thread::yield();
+        STX_CHECK(!acquired);
+        lock.unlock();
+        waiter.join();
+        STX_CHECK(acquired);
+    }
+
+    void test_exponential_backoff()
+    {
+        // Pauses grow until the limit and then yield; either way it returns.
+        stx::exponential_backoff<1, 8> backoff;
+        for (int i = 0; i != 20; ++i)
+            backoff();
+        stx::pause_backoff pause;
+        pause();
+        stx::cpu_relax();
+    }
+
+    using namespace std::chrono_literals;
+
+    // Readers check that the writers' two updates are never seen apart.
+    void test_shared_exclusion()
+    {
+        stx::shared_spinlock lock;
+        long a = 0, b = 0;
+        std::atomic<bool> stop(false);
+        std::atomic<long> reads(0);
+        std::vector<std::thread> pool;
+        for (int r = 0; r != 3; ++r)
+        {
+            pool.emplace_back([&]
+            {
+                while (!stop)
+                {
+                    std::shared_lock<stx::shared_spinlock> guard(lock);
+                    STX_CHECK(a == b);
+                    ++reads;
+                }
+            });
+        }
+        for (int w = 0; w != 2; ++w)
+        {
+            pool.emplace_back([&]
+            {
+                for (int i = 0; i != 5000; ++i)
+                {
+                    std::lock_guard<stx::shared_spinlock> guard(lock);
+                    ++a;
+                    ++b;
+                }
+            });
+        }
+        // Writers finish despite the stream of readers.
+        pool[3].join();
+        pool[4].join();
+        stop = true;
+        for (int r = 0; r != 3; ++r)
+            pool[r].join();
+        STX_CHECK(a == 10000 && b == 10000);
+    }
+
+    // Once a writer waits, new readers are turned away.
+    void test_writer_preference()
+    {
+        stx::shared_spinlock lock;
+        lock.lock_shared();
+        std::atomic<bool> written(false);
+        std::thread writer([&]
+        {
+            lock.lock();
+            written = true;
+            lock.unlock();
+        });
+        auto deadline = std::chrono::steady_clock::now() + 10s;
+        for (;;)
+        {
+            STX_CHECK(std::chrono::steady_clock::now() < deadline);
+            if (!lock.try_lock_shared())
+                break;
+            lock.unlock_shared();
+            std::this_thread::yield();
+        }
+        STX_CHECK(!lock.try_lock_shared_for(1ms));
+        STX_CHECK(!written);
+        lock.unlock_shared();
+        writer.join();
+        STX_CHECK(written);
+        STX_CHECK(lock.try_lock_shared());
+        lock.unlock_shared();
+    }
+
+    void test_timed()
+    {
+        stx::shared_spinlock lock;
+        STX_CHECK(lock.try_lock_for(1ms));
+        STX_CHECK(!lock.try_lock_shared_for(5ms));
+        std::thread([&]
+        {
+            STX_CHECK(!lock.try_lock_for(5ms));
+        }).join();
+        lock.unlock();
+
+        lock.lock_shared();
+        auto start = std::chrono::steady_clock::now();
+        STX_CHECK(!lock.try_lock_until(start + 20ms));
+        STX_CHECK(std::chrono::steady_clock::now() - start >= 20ms);
+        // The timed-out writer withdrew its claim, so readers get in.
+        STX_CHECK(lock.try_lock_shared_for(1ms));
+        lock.unlock_shared();
+        lock.unlock_shared();
+        STX_CHECK(lock.try_lock());
+        lock.unlock();
+    }
+}
+
+int main()
+{
+    test_exclusion<stx::spinlock>();
+    test_exclusion<stx::basic_spinlock<stx::pause_backoff>>();
+    test_exclusion<stx::basic_spinlock<stx::exponential_backoff<1, 16>>>();
+    test_exclusion<stx::basic_spinlock<counting_backoff>>();
+    test_try_lock();
+    test_backoff_used();
+    test_exponential_backoff();
+    test_shared_exclusion();
+    test_writer_preference();
+    test_timed();
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/static_btree_set.hpp>
+#include <stx/traits/find.hpp>
+#include <stx/traits/contains.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "check.hpp"
+
+namespace
+{
+    // `it` points to `v[i]`, or is `end` for `i == v.size()`.
+    template<class Set, class T>
+    bool same(Set const& s, typename Set::const_iterator it, std::vector<T> const& v, std::size_t i)
+    {
+        return i == v.size()? it == s.end() : it != s.end() && !(*it < v[i]) && !(v[i] < *it);
+    }
+
+    template<class T, class Compare, class Make>
+    void check(std::vector<T> v, Compare comp, Make make, std::mt19937& rng)
+    {
+        std::sort(v.begin(), v.end(), comp);
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        stx::static_btree_set<T, Compare> s(v.begin(), v.end(), comp);
+        STX_CHECK(s.size() == v.size());
+        STX_CHECK(s.empty() == v.empty());
+
+        // The leaves are the sorted keys.
+        STX_CHECK(std::equal(s.begin(), s.end(), v.begin(), v.end()));
+        STX_CHECK(s.data() == s.begin());
+
+        for (int k = 0; k != 200; ++k)
+        {
+            T val = v.empty() || k % 2? make(rng) : v[rng() % v.size()];
+            std::size_t lb = std::size_t(std::lower_bound(v.begin(), v.end(), val, comp) - v.begin());
+            bool present = lb != v.size() && !comp(val, v[lb]);
+            STX_CHECK(same(s, s.lower_bound(val), v, lb));
+            STX_CHECK(same(s, s.find(val), v, present? lb : v.size()));
+            STX_CHECK(s.contains(val) == present);
+            STX_CHECK(stx::traits::contains(s, val) == present);
+            STX_CHECK(stx::traits::find(s, val) == s.find(val));
+            STX_CHECK(s.lower_bound(val) == s.begin() + lb);
+        }
+    }
+
+    template<class T, class Make>
+    void test(Make make)
+    {
+        std::mt19937 rng(42);
+        std::vector<std::size_t> sizes;
+        for (std::size_t n = 0; n != 70; ++n)
+            sizes.push_back(n);
+        // Around full trees of one, two and three levels for 32-bit keys.
+        for (std::size_t n : {1088u, 1089u, 1090u, 35936u, 35937u, 35938u})
+            sizes.push_back(n);
+        for (std::size_t n : sizes)
+        {
+            std::vector<T> v(n);
+            for (T& x : v)
+                x = make(rng);
+            check(v, std::less<T>(), make, rng);
+            check(v, std::greater<T>(), make, rng);
+        }
+    }
+}
+
+int main()
+{
+    test<int>([](std::mt19937& rng) { return int(rng() % 20000) - 10000; });
+    test<std::int64_t>([](std::mt19937& rng) { return std::int64_t(rng()) << 20; });
+    test<double>([](std::mt19937& rng) { return double(rng() % 10000) / 8; });
+    test<std::string>([](std::mt19937& rng) { return std::to_string(rng() % 5000); });
+
+    stx::static_btree_set<int> empty;
+    STX_CHECK(empty.empty() && empty.begin() == empty.end());
+    STX_CHECK(empty.find(1) == empty.end() && !empty.contains(1));
+    stx::static_btree_set<int> small{1, 3, 5};
+    STX_CHECK(*small.lower_bound(2) == 3 && small.lower_bound(6) == small.end());
+}
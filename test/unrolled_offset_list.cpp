@@ -0,0 +1,230 @@
+/*//////////////////////////////////////////////////////////////////////////////
+    Copyright (c) 2026 Jamboree
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//////////////////////////////////////////////////////////////////////////////*/
+#include <stx/container/unrolled_offset_list.hpp>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <iterator>
+#include "check.hpp"
+
+namespace
+{
+    template<class List, class Model>
+    bool same(List const& l, Model const& model)
+    {
+        return l.size() == model.size()
+            && std::equal(l.begin(), l.end(), model.begin(), model.end())
+            && std::equal(l.rbegin(), l.rend(), model.rbegin(), model.rend());
+    }
+
+    // The element counts of the nodes, found from the gaps between the
+    // addresses of consecutive elements.
+    template<class List>
+    std::vector<std::size_t> node_counts(List const& l)
+    {
+        std::vector<std::size_t> counts;
+        typename List::value_type const* last = nullptr;
+        for (auto const& x : l)
+        {
+            if (last && &x == last + 1)
+                ++counts.back();
+            else
+                counts.push_back(1);
+            last = &x;
+        }
+        return counts;
+    }
+
+    template<class T>
+    T make(std::mt19937& rng);
+
+    template<>
+    int make<int>(std::mt19937& rng)
+    {
+        return int(rng() % 1000);
+    }
+
+    template<>
+    std::string make<std::string>(std::mt19937& rng)
+    {
+        // Long enough to be on the heap, so leaks and double frees show.
+        return std::string(20 + rng() % 10, char('a' + rng() % 26));
+    }
+
+    template<class T, std::size_t N>
+    void test_model()
+    {
+        using list = stx::unrolled_offset_list<T, std::allocator<T>, N>;
+        std::mt19937 rng(static_cast<unsigned>(N));
+        list a, b;
+        std::list<T> ma, mb;
+        auto pick = [&](std::size_t n)
+        {
+            return std::size_t(rng() % (n + 1));
+        };
+        for (int step = 0; step != 8000; ++step)
+        {
+            T v = make<T>(rng);
+            std::size_t k = pick(ma.size());
+            switch (rng() % 14)
+            {
+            case 0:
+                a.push_back(v);
+                ma.push_back(v);
+                break;
+            case 1:
+                a.push_front(v);
+                ma.push_front(v);
+                break;
+            case 2:
+                if (!ma.empty())
+                {
+                    a.pop_back();
+                    ma.pop_back();
+                }
+                break;
+            case 3:
+                if (!ma.empty())
+                {
+                    a.pop_front();
+                    ma.pop_front();
+                }
+                break;
+            case 4:
+            case 5:
+            {
+                auto it = a.insert(std::next(a.begin(), k), v);
+                STX_CHECK(*it == v && std::distance(a.begin(), it) == std::ptrdiff_t(k));
+                ma.insert(std::next(ma.begin(), k), v);
+                break;
+            }
+            case 6:
+            {
+                std::size_t n = pick(2 * N);
+                a.insert(std::next(a.begin(), k), n, v);
+                ma.insert(std::next(ma.begin(), k), n, v);
+                break;
+            }
+            case 7:
+            case 8:
+                if (k != ma.size())
+                {
+                    auto it = a.erase(std::next(a.begin(), k));
+                    STX_CHECK(std::distance(a.begin(), it) == std::ptrdiff_t(k));
+                    ma.erase(std::next(ma.begin(), k));
+                }
+                break;
+            case 9:
+            {
+                std::size_t j = k + pick(std::min<std::size_t>(ma.size() - k, 3 * N));
+                auto it = a.erase(std::next(a.begin(), k), std::next(a.begin(), j));
+                STX_CHECK(std::distance(a.begin(), it) == std::ptrdiff_t(k));
+                ma.erase(std::next(ma.begin(), k), std::next(ma.begin(), j));
+                break;
+            }
+            case 10:
+            {
+                std::size_t n = pick(ma.size() + N);
+                a.resize(n, v);
+                ma.resize(n, v);
+                break;
+            }
+            case 11:
+                for (std::size_t n = pick(3 * N); n; --n)
+                {
+                    T x = make<T>(rng);
+                    b.push_back(x);
+                    mb.push_back(x);
+                }
+                a.splice(std::next(a.begin(), k), b);
+                ma.splice(std::next(ma.begin(), k), mb);
+                break;
+            case 12:
+                a.swap(b);
+                ma.swap(mb);
+                break;
+            default:
+            {
+                auto pred = [&](T const& x)
+                {
+                    return x < v;
+                };
+                if (rng() % 4 == 0)
+                {
+                    a.remove_if(pred);
+                    ma.remove_if(pred);
+                }
+                break;
+            }
+            }
+            STX_CHECK(same(a, ma));
+            STX_CHECK(same(b, mb));
+        }
+        list c(a);
+        STX_CHECK(c == a);
+        a.clear();
+        STX_CHECK(a.empty() && a.begin() == a.end());
+        a = std::move(c);
+        STX_CHECK(same(a, ma));
+    }
+
+    // Under single-element insert/erase churn every node but the last
+    // stays at least half full.
+    template<std::size_t N>
+    void test_density()
+    {
+        using list = stx::unrolled_offset_list<int, std::allocator<int>, N>;
+        std::mt19937 rng(7);
+        list l;
+        std::size_t size = 0;
+        for (int step = 0; step != 20000; ++step)
+        {
+            // Grow to about 1000 elements, then churn around that size.
+            std::size_t k = rng() % (size + 1);
+            if (size < 200 || rng() % 2000 < 2000 - size)
+            {
+                l.insert(std::next(l.begin(), k), step);
+                ++size;
+            }
+            else if (k != size)
+            {
+                l.erase(std::next(l.begin(), k));
+                --size;
+            }
+            if (step % 97 == 0)
+            {
+                std::vector<std::size_t> counts = node_counts(l);
+                for (std::size_t i = 0; i + 1 < counts.size(); ++i)
+                    STX_CHECK(counts[i] >= N / 2 && counts[i] <= N);
+                STX_CHECK(counts.empty() || counts.back() <= N);
+            }
+        }
+        STX_CHECK(l.size() == size);
+
+        // Erasing most elements keeps merging the nodes.
+        l.remove_if([](int x)
+        {
+            return x % 10 != 0;
+        });
+        std::vector<std::size_t> counts = node_counts(l);
+        STX_CHECK(counts.size() <= l.size() / (N / 2) + 1);
+    }
+}
+
+int main()
+{
+    static_assert(stx::unrolled_offset_list<int>::node_capacity >= 16, "");
+    test_model<int, 2>();
+    test_model<int, 5>();
+    test_model<int, 8>();
+    test_model<int, stx::unrolled_offset_list<int>::node_capacity>();
+    test_model<std::string, 4>();
+    test_density<4>();
+    test_density<7>();
+    test_density<16>();
+}
\ No newline at end of file